@@ -0,0 +1,303 @@
+#ifndef HOST_GENESIS_H
+#define HOST_GENESIS_H
+
+// Host stand-in for SGDK's <genesis.h>.
+// Only the subset of SGDK used by the game logic is declared here. Types and
+// macros follow SGDK 2.x (fix32 is 22.10) so game code compiles unchanged.
+// Hardware calls are recorded into hostRec (see host.h) instead of touching
+// a VDP.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// ============================================================================
+// Types
+// ============================================================================
+
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+
+typedef volatile u8 vu8;
+typedef volatile u16 vu16;
+typedef volatile u32 vu32;
+
+typedef u8 bool;
+
+#define TRUE 1
+#define FALSE 0
+
+typedef s16 fix16;
+typedef s32 fix32;
+
+// ============================================================================
+// Maths
+// ============================================================================
+
+#define FIX16_INT_BITS 10
+#define FIX16_FRAC_BITS (16 - FIX16_INT_BITS)
+#define FIX32_INT_BITS 22
+#define FIX32_FRAC_BITS (32 - FIX32_INT_BITS)
+
+#define FIX16(value) ((fix16) ((value) * (1 << FIX16_FRAC_BITS)))
+#define FIX32(value) ((fix32) ((value) * (1 << FIX32_FRAC_BITS)))
+
+#define F16_toInt(value) ((s16) ((value) >> FIX16_FRAC_BITS))
+#define F32_toInt(value) ((s32) ((value) >> FIX32_FRAC_BITS))
+#define F32_frac(value) ((value) & ((1 << FIX32_FRAC_BITS) - 1))
+#define F32_mul(val1, val2) (((val1) >> (FIX32_FRAC_BITS / 2)) * ((val2) >> (FIX32_FRAC_BITS / 2)))
+#define F32_div(val1, val2) (((val1) << (FIX32_FRAC_BITS / 2)) / ((val2) >> (FIX32_FRAC_BITS / 2)))
+
+#ifndef min
+#define min(X, Y) (((X) < (Y)) ? (X) : (Y))
+#endif
+#ifndef max
+#define max(X, Y) (((X) > (Y)) ? (X) : (Y))
+#endif
+
+// ============================================================================
+// Joypad
+// ============================================================================
+
+#define JOY_1 0x0000
+#define JOY_2 0x0001
+#define JOY_NUM 0x0002
+
+#define BUTTON_UP 0x0001
+#define BUTTON_DOWN 0x0002
+#define BUTTON_LEFT 0x0004
+#define BUTTON_RIGHT 0x0008
+#define BUTTON_A 0x0040
+#define BUTTON_B 0x0010
+#define BUTTON_C 0x0020
+#define BUTTON_START 0x0080
+#define BUTTON_X 0x0400
+#define BUTTON_Y 0x0200
+#define BUTTON_Z 0x0100
+#define BUTTON_MODE 0x0800
+
+typedef void JoyEventCallback(u16 joy, u16 changed, u16 state);
+
+void JOY_init();
+void JOY_setEventHandler(JoyEventCallback* CB);
+u16 JOY_readJoypad(u16 joy);
+void JOY_update();
+
+// ============================================================================
+// VDP
+// ============================================================================
+
+typedef enum {
+    BG_A,
+    BG_B,
+    WINDOW
+} VDPPlane;
+
+typedef enum {
+    CPU,
+    DMA,
+    DMA_QUEUE,
+    DMA_QUEUE_COPY
+} TransferMethod;
+
+#define PAL0 0
+#define PAL1 1
+#define PAL2 2
+#define PAL3 3
+
+#define HSCROLL_PLANE 0
+#define HSCROLL_TILE 2
+#define HSCROLL_LINE 3
+#define VSCROLL_PLANE 0
+#define VSCROLL_COLUMN 1
+
+#define TILE_SIZE 32
+#define TILE_MAX_NUM 2048
+#define TILE_SYSTEM_INDEX 0x0000
+#define TILE_SYSTEM_LENGTH 16
+#define TILE_USER_INDEX (TILE_SYSTEM_INDEX + TILE_SYSTEM_LENGTH)
+// Default SGDK VRAM layout leaves roughly this many tiles below the planes
+#define TILE_USER_LENGTH 1520
+#define TILE_USER_MAX_INDEX (TILE_USER_INDEX + TILE_USER_LENGTH - 1)
+
+#define TILE_ATTR_PRIORITY_SFT 15
+#define TILE_ATTR_PALETTE_SFT 13
+#define TILE_ATTR_VFLIP_SFT 12
+#define TILE_ATTR_HFLIP_SFT 11
+
+#define TILE_ATTR(pal, prio, flipV, flipH) \
+    ((((u16)(flipH)) << TILE_ATTR_HFLIP_SFT) + (((u16)(flipV)) << TILE_ATTR_VFLIP_SFT) + \
+     (((u16)(pal)) << TILE_ATTR_PALETTE_SFT) + (((u16)(prio)) << TILE_ATTR_PRIORITY_SFT))
+#define TILE_ATTR_FULL(pal, prio, flipV, flipH, index) \
+    (TILE_ATTR(pal, prio, flipV, flipH) + ((u16)(index)))
+
+#define COMPRESSION_AUTO -1
+#define COMPRESSION_NONE 0
+#define COMPRESSION_APLIB 1
+#define COMPRESSION_LZ4W 2
+
+typedef struct {
+    u16 length;
+    u16* data;
+} Palette;
+
+typedef struct {
+    u16 compression;
+    u16 numTile;
+    u32* tiles;
+} TileSet;
+
+typedef struct {
+    u16 compression;
+    u16 w;
+    u16 h;
+    u16* tilemap;
+} TileMap;
+
+typedef struct {
+    Palette* palette;
+    TileSet* tileset;
+    TileMap* tilemap;
+} Image;
+
+#define PLANE_A_ADDR 0xC000
+#define PLANE_B_ADDR 0xE000
+#define WINDOW_ADDR 0xB000
+#define PLANE_W 64
+#define PLANE_H 32
+
+#define HSCROLL_TABLE_ADDR 0xFC00
+
+u16 VDP_getPlaneAddress(VDPPlane plane, u16 x, u16 y);
+u16 VDP_getHScrollTableAddress();
+bool VDP_loadTileSet(const TileSet* tileset, u16 index, TransferMethod tm);
+void VDP_loadTileData(const u32* data, u16 index, u16 num, TransferMethod tm);
+TileSet* unpackTileSet(const TileSet* src, TileSet* dest);
+void VDP_setScrollingMode(u16 hscroll, u16 vscroll);
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value);
+void VDP_setVerticalScroll(VDPPlane plane, s16 value);
+bool VDP_drawImageEx(VDPPlane plane, const Image* image, u16 basetile, u16 x, u16 y, bool loadpal, bool dma);
+#define TILE_FONT_INDEX (TILE_MAX_NUM - 96)
+
+void VDP_drawText(const char* str, u16 x, u16 y);
+VDPPlane VDP_getTextPlane();
+u16 VDP_getTextPalette();
+u16 VDP_getTextPriority();
+void VDP_clearTextArea(u16 x, u16 y, u16 w, u16 h);
+
+// Raw H/V counter; the host has no beam, so this reads a value the driver sets
+extern u16 hostHVCounter;
+#define GET_HVCOUNTER (hostHVCounter)
+#define GET_VCOUNTER (hostHVCounter >> 8)
+#define GET_HCOUNTER (hostHVCounter & 0xFF)
+
+void PAL_setPalette(u16 numPal, const u16* pal, TransferMethod tm);
+void PAL_getColors(u16 index, u16* dest, u16 count);
+bool PAL_fadeOutAll(u16 numFrame, bool async);
+bool PAL_fadeInAll(const u16* pal, u16 numFrame, bool async);
+bool PAL_isDoingFade();
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+void* MEM_alloc(u16 size);
+void MEM_free(void* ptr);
+
+// ============================================================================
+// DMA
+// ============================================================================
+
+#define DMA_VRAM 0
+#define DMA_CRAM 1
+#define DMA_VSRAM 2
+
+bool DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step);
+void DMA_doDma(u8 location, void* from, u16 to, u16 len, s16 step);
+u16 DMA_getQueueTransferSize();
+
+// ============================================================================
+// Sprites
+// ============================================================================
+
+typedef struct {
+    u8 numSprite;
+    u8 timer;
+    TileSet* tileset;
+} AnimationFrame;
+
+typedef struct {
+    u8 numFrame;
+    u8 loop;
+    AnimationFrame** frames;
+} Animation;
+
+typedef struct {
+    u16 w;
+    u16 h;
+    Palette* palette;
+    u16 numAnimation;
+    Animation** animations;
+    u16 maxNumTile;
+    u16 maxNumSprite;
+} SpriteDefinition;
+
+#define SPR_FLAG_AUTO_VISIBILITY 0x4000
+#define SPR_FLAG_FAST_AUTO_VISIBILITY 0x2000
+#define SPR_FLAG_AUTO_VRAM_ALLOC 0x1000
+#define SPR_FLAG_AUTO_SPRITE_ALLOC 0x0800
+#define SPR_FLAG_AUTO_TILE_UPLOAD 0x0400
+#define SPR_FLAG_MASK 0x7C00
+
+typedef enum {
+    VISIBLE,
+    HIDDEN,
+    AUTO_FAST,
+    AUTO_SLOW
+} SpriteVisibility;
+
+typedef struct {
+    const SpriteDefinition* definition;
+    u16 attribut;
+    s16 x;
+    s16 y;
+    bool hflip;
+    bool used;
+    SpriteVisibility visibility;
+    s16 depth;
+    u16 flags;
+    s16 animInd;
+    s16 frameInd;
+    s16 vramTileIndex;
+} Sprite;
+
+void SPR_init();
+Sprite* SPR_addSprite(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut);
+Sprite* SPR_addSpriteEx(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut, u16 flag);
+void SPR_releaseSprite(Sprite* sprite);
+void SPR_setPosition(Sprite* sprite, s16 x, s16 y);
+void SPR_setHFlip(Sprite* sprite, bool value);
+void SPR_setVisibility(Sprite* sprite, SpriteVisibility value);
+void SPR_setDepth(Sprite* sprite, s16 value);
+void SPR_setAnimAndFrame(Sprite* sprite, s16 anim, s16 frame);
+void SPR_setFrame(Sprite* sprite, s16 frame);
+void SPR_setVRAMTileIndex(Sprite* sprite, s16 value);
+void SPR_update();
+
+// ============================================================================
+// System
+// ============================================================================
+
+void SYS_doVBlankProcess();
+bool SYS_isPAL();
+bool SYS_isNTSC();
+
+// Debug log (emulator console on hardware, stderr on host)
+int kprintf(const char* fmt, ...);
+
+#endif // HOST_GENESIS_H
@@ -0,0 +1,73 @@
+#ifndef HOST_H
+#define HOST_H
+
+#include <genesis.h>
+
+#define HOST_MAX_SPRITES 80
+
+/**
+ * @brief Counters for every hardware call made by the game logic
+ *
+ * The stub SGDK layer never touches hardware; it records what would have
+ * been sent to the VDP so a run can be inspected after the fact.
+ */
+typedef struct {
+    u32 frames;
+
+    u32 joyReads;
+    u32 joyEvents;
+
+    u32 hscrollWrites;
+    u32 vscrollWrites;
+    s16 hscroll[2];     // Last value written for BG_A / BG_B
+    s16 vscroll[2];
+
+    u32 dmaQueued;      // DMA_queueDma calls
+    u32 dmaQueuedWords;
+    u32 dmaImmediate;   // DMA_doDma calls
+    u32 dmaImmediateWords;
+    u32 tilesetLoads;
+    u32 tilesetTiles;
+    u32 tileUnpacks;
+
+    u32 imageDraws;
+    u32 imageTiles;
+    u32 paletteLoads;
+    u32 paletteFades;
+    u32 textDraws;
+    u32 textChars;
+    u32 textClears;
+
+    u32 memAllocs;      // MEM_alloc calls
+
+    u32 spriteAdds;
+    u32 spriteReleases;
+    u32 spriteMoves;
+    u32 spriteFlips;
+    u32 spriteVisibility;
+    u32 spriteDepths;
+    u32 spriteFrames;   // Animation/frame changes
+    u32 spriteUpdates;
+} HostRecorder;
+
+extern HostRecorder hostRec;
+
+/**
+ * @brief Reset the stub SGDK state (pads, sprites, recorder)
+ */
+void hostReset();
+
+/**
+ * @brief Set the pad state that the next JOY_update() will latch
+ * @param joy Joystick number (JOY_1, JOY_2)
+ * @param state Button mask
+ */
+void hostSetJoypad(u16 joy, u16 state);
+
+/**
+ * @brief Monotonic wall clock for timing host runs
+ * @return Seconds since an arbitrary start
+ */
+double hostNowSeconds();
+
+#endif // HOST_H
@@ -0,0 +1,14 @@
+#ifndef HOST_RESOURCES_H
+#define HOST_RESOURCES_H
+
+#include <genesis.h>
+
+// Host stand-in for the rescomp output of res/resources.res.
+// Dimensions match the real assets so VRAM accounting stays realistic.
+
+extern const Image background;
+extern const Image foreground;
+extern const Image hubLevel;
+extern const SpriteDefinition pSprite;
+
+#endif // HOST_RESOURCES_H
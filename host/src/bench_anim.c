@@ -0,0 +1,75 @@
+#include <genesis.h>
+#include "host.h"
+#include "systems/animation.h"
+#include "systems/animBatch.h"
+
+// Per-object AnimState + animUpdate() vs the batched animation stage.
+// Both run the same looping 4-frame walk cycles at mixed speeds; the
+// AnimState side detects frame changes itself to fire the same frame events.
+// Reports bytes per animation, host time per frame and event counts (which
+// must match).
+
+#define ANIMS ANIM_MAX_SLOTS
+#define FRAMES 100000
+
+static const u16 walkFrameIndices[] = { 0, 1, 2, 3 };
+static const u8 walkEvents[] = { ANIM_EVENT_NONE, ANIM_EVENT_FOOTSTEP, ANIM_EVENT_HITBOX_ON, ANIM_EVENT_HITBOX_OFF };
+
+static AnimStateDef walkDefs[4];
+static AnimSeqFrame walkSeqFrames[4][4];
+static AnimSeq walkSeqs[4];
+
+static AnimState states[ANIMS];
+static u32 stateEvents;
+static u32 batchEvents;
+
+static void countEvent(u8 anim, u8 owner, u8 arg) {
+    (void) anim; (void) owner; (void) arg;
+    batchEvents++;
+}
+
+// Speeds 4, 6, 8, 10 updates per frame
+static void buildDefs() {
+    for (u16 d = 0; d < 4; d++) {
+        u8 speed = 4 + d * 2;
+
+        walkDefs[d] = (AnimStateDef) { walkFrameIndices, 4, speed, TRUE };
+        for (u16 f = 0; f < 4; f++) {
+            walkSeqFrames[d][f] = (AnimSeqFrame) { f, speed, walkEvents[f], 0 };
+        }
+        walkSeqs[d] = (AnimSeq) { walkSeqFrames[d], 4, TRUE };
+    }
+}
+
+int main() {
+    buildDefs();
+
+    for (u16 i = 0; i < ANIMS; i++) animInit(&states[i], &walkDefs[i & 3]);
+
+    double start = hostNowSeconds();
+    for (u32 frame = 0; frame < FRAMES; frame++) {
+        for (u16 i = 0; i < ANIMS; i++) {
+            u16 before = states[i].currentFrame;
+            animUpdate(&states[i]);
+            if (states[i].currentFrame != before && walkEvents[states[i].currentFrame]) stateEvents++;
+        }
+    }
+    double stateNs = (hostNowSeconds() - start) * 1e9 / FRAMES;
+
+    animBatchInit();
+    for (u16 e = ANIM_EVENT_NONE + 1; e < ANIM_EVENT_COUNT; e++) animSetEventHandler(e, countEvent);
+    for (u16 i = 0; i < ANIMS; i++) animAdd(&walkSeqs[i & 3], i);
+
+    start = hostNowSeconds();
+    for (u32 frame = 0; frame < FRAMES; frame++) animBatchUpdate();
+    double batchNs = (hostNowSeconds() - start) * 1e9 / FRAMES;
+
+    u16 batchBytes = (sizeof(animSlots) - 1) / ANIMS;
+
+    printf("%u animations  AnimState: %2u bytes each %7.0f ns/frame %8u events\n",
+           ANIMS, (u16) sizeof(AnimState), stateNs, stateEvents);
+    printf("%u animations  animBatch: %2u bytes each %7.0f ns/frame %8u events (%u transitions)\n",
+           ANIMS, batchBytes, batchNs, batchEvents, animBatchStats.transitions - ANIMS);
+
+    return stateEvents == batchEvents ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+#include <genesis.h>
+#include "host.h"
+#include "systems/collision.h"
+#include "systems/broadphase.h"
+
+// Grid broadphase vs brute-force all-pairs collisionAABB at 16/64/128 boxes.
+// Reports AABB tests per frame (the 68000 cost driver) and host time, and
+// checks both find the same number of overlapping pairs.
+
+#define WORLD_WIDTH 1024
+#define WORLD_HEIGHT 512
+#define FRAMES 2000
+
+static CollisionBox boxes[BROAD_MAX_BOXES];
+static u32 gridPairs;
+
+static u32 rng = 12345;
+
+static u16 nextRandom() {
+    rng = rng * 1103515245 + 12345;
+    return (rng >> 16) & 0x7FFF;
+}
+
+static void scatterBoxes(u16 count) {
+    for (u16 i = 0; i < count; i++) {
+        boxes[i].width = 8 + (nextRandom() % 25);
+        boxes[i].height = 8 + (nextRandom() % 41);
+        boxes[i].x = nextRandom() % (WORLD_WIDTH - boxes[i].width);
+        boxes[i].y = nextRandom() % (WORLD_HEIGHT - boxes[i].height);
+    }
+}
+
+static void countPair(u16 a, u16 b) {
+    (void) a; (void) b;
+    gridPairs++;
+}
+
+static bool runSize(u16 count) {
+    u32 brutePairs = 0;
+    u32 bruteTests = 0;
+    u32 gridTests = 0;
+    double start;
+
+    gridPairs = 0;
+
+    // Same box layouts for both, re-scattered each frame
+    u32 seed = rng;
+
+    start = hostNowSeconds();
+    for (u16 frame = 0; frame < FRAMES; frame++) {
+        scatterBoxes(count);
+        for (u16 i = 0; i < count; i++) {
+            for (u16 j = i + 1; j < count; j++) {
+                bruteTests++;
+                if (collisionAABB(&boxes[i], &boxes[j])) brutePairs++;
+            }
+        }
+    }
+    double bruteNs = (hostNowSeconds() - start) * 1e9 / FRAMES;
+
+    rng = seed;
+
+    start = hostNowSeconds();
+    for (u16 frame = 0; frame < FRAMES; frame++) {
+        scatterBoxes(count);
+        broadClear();
+        for (u16 i = 0; i < count; i++) broadInsert(&boxes[i]);
+        broadForEachPair(countPair);
+        gridTests += broadStats.tests;
+    }
+    double gridNs = (hostNowSeconds() - start) * 1e9 / FRAMES;
+
+    printf("%4u boxes  brute: %6u tests %4.1f pairs %8.0f ns  "
+           "grid: %5u tests %4.1f pairs %8.0f ns  (%.1fx fewer tests)\n",
+           count, bruteTests / FRAMES, (double) brutePairs / FRAMES, bruteNs,
+           gridTests / FRAMES, (double) gridPairs / FRAMES, gridNs,
+           (double) bruteTests / (gridTests ? gridTests : 1));
+
+    return brutePairs == gridPairs;
+}
+
+int main() {
+    static const u16 sizes[] = { 16, 64, 128 };
+    bool ok = TRUE;
+
+    // Host times include scattering the boxes; test counts are what scale on the 68000
+    for (u16 i = 0; i < 3; i++) {
+        if (!runSize(sizes[i])) {
+            printf("pair count mismatch at %u boxes\n", sizes[i]);
+            ok = FALSE;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <genesis.h>
+#include "systems/hitbox.h"
+#include "systems/animBatch.h"
+#include "entities/animData.h"
+
+// Box tests per frame in a fight: the hitbox stage vs testing every hitbox
+// against every hurtbox. The player loops the baked attack sequence (turning
+// after each swing) in the middle of a screen of walking enemies, whose
+// contact hitboxes are always out. Hits found by both methods must match.
+
+#define FRAMES 6000
+#define MAX_ENEMIES 24
+#define PLAYER_ID 0
+#define TEAM_PLAYER 0
+#define TEAM_ENEMY 1
+
+typedef struct {
+    s16 x;
+    s16 y;
+    s16 dx;
+} Walker;
+
+static Walker enemies[MAX_ENEMIES];
+
+static void place(CollisionBox* out, const FrameBox* b, s16 x, s16 y, u8 width, bool facingRight) {
+    out->x = facingRight ? x + b->x : x + (s16) width - b->x - (s16) b->width;
+    out->y = y + b->y;
+    out->width = b->width;
+    out->height = b->height;
+}
+
+static bool overlaps(const CollisionBox* a, const CollisionBox* b) {
+    return a->x < b->x + (s16) b->width && a->x + (s16) a->width > b->x &&
+           a->y < b->y + (s16) b->height && a->y + (s16) a->height > b->y;
+}
+
+typedef struct {
+    u16 id;
+    u8 team;
+    s16 x;
+    s16 y;
+    bool facingRight;
+    const FrameBoxes* boxes;
+} Actor;
+
+/**
+ * Every hitbox against every other-team hurtbox; counts distinct hit pairs.
+ */
+static u16 bruteForce(const Actor* actors, u16 count, u32* tests) {
+    u16 hits = 0;
+
+    for (u16 a = 0; a < count; a++) {
+        const FrameBoxes* fa = actors[a].boxes;
+
+        for (u16 v = 0; v < count; v++) {
+            const FrameBoxes* fv = actors[v].boxes;
+            bool hit = FALSE;
+
+            if (actors[a].team == actors[v].team) continue;
+
+            for (u8 h = 0; h < fa->hitCount; h++) {
+                CollisionBox hb;
+                place(&hb, &fa->boxes[fa->hurtCount + h], actors[a].x, actors[a].y, 16, actors[a].facingRight);
+
+                for (u8 u = 0; u < fv->hurtCount; u++) {
+                    CollisionBox ub;
+                    place(&ub, &fv->boxes[u], actors[v].x, actors[v].y, 16, actors[v].facingRight);
+
+                    (*tests)++;
+                    if (overlaps(&hb, &ub)) hit = TRUE;
+                }
+            }
+            if (hit) hits++;
+        }
+    }
+    return hits;
+}
+
+static void countHit(u16 attacker, u16 victim) {
+    (void) attacker; (void) victim;
+}
+
+static bool runFight(u16 count) {
+    static Actor actors[MAX_ENEMIES + 1];
+    u32 bruteTests = 0;
+    u32 bruteHits = 0;
+    u32 stageHits = 0;
+    bool facingRight = TRUE;
+
+    animBatchInit();
+    hitboxInit();
+
+    u8 anim = animAdd(&playerAttackSeq, 0);
+
+    // Spread over one screen, walking in both directions at mixed speeds
+    for (u16 i = 0; i < count; i++) {
+        enemies[i].x = (i * 300) / count;
+        enemies[i].y = 200;
+        enemies[i].dx = (i & 1) ? -1 - (i % 3) : 1 + (i % 3);
+    }
+
+    for (u32 frame = 0; frame < FRAMES; frame++) {
+        animBatchUpdate();
+        if (animFinished(anim)) {
+            facingRight = !facingRight;
+            animPlay(anim, &playerAttackSeq);
+        }
+
+        actors[0] = (Actor) { PLAYER_ID, TEAM_PLAYER, 152, 172, facingRight, animBoxes(anim) };
+        for (u16 i = 0; i < count; i++) {
+            Walker* w = &enemies[i];
+
+            w->x += w->dx;
+            if (w->x < 0 || w->x > 304) w->dx = -w->dx;
+
+            actors[i + 1] = (Actor) { i + 1, TEAM_ENEMY, w->x, w->y, w->dx > 0, &enemyBoxes };
+        }
+
+        hitboxBegin();
+        for (u16 i = 0; i <= count; i++) {
+            hitboxSubmit(actors[i].id, actors[i].team, actors[i].x, actors[i].y, 16,
+                         actors[i].facingRight, actors[i].boxes);
+        }
+        stageHits += hitboxResolve(countHit);
+
+        bruteHits += bruteForce(actors, count + 1, &bruteTests);
+    }
+
+    printf("%2u enemies  all pairs %6.1f tests/frame  hitbox stage %5.1f tests/frame (peak %3u)  hits %u/%u%s\n",
+           count, (double) bruteTests / FRAMES, (double) hitboxStats.testsTotal / FRAMES,
+           hitboxStats.peakTests, stageHits, bruteHits, hitboxStats.dropped ? "  (boxes dropped)" : "");
+
+    return stageHits == bruteHits;
+}
+
+int main() {
+    static const u16 fights[] = { 4, 8, 16, 24 };
+    bool ok = TRUE;
+
+    for (u16 i = 0; i < 4; i++) {
+        if (!runFight(fights[i])) {
+            printf("  hits differ from the all-pairs test\n");
+            ok = FALSE;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#include <genesis.h>
+#include "host.h"
+#include "core/config.h"
+#include "systems/damping.h"
+
+// Equivalence check and timing of the division-free damping kernel against
+// the original applyFriction() arithmetic: (velX * 85) / 100 and
+// (velX * 95) / 100 followed by the 0.1 dead zone.
+
+#define TIMING_ROUNDS 200
+
+// MC68000 cycle model: the instruction sequences each version compiles to,
+// costed from the 68000 timing tables (register operands, no wait states,
+// negative velocity that doesn't snap to rest). The legacy divide goes
+// through libgcc's __divsi3, which for a 16-bit divisor is two divu.w
+// (costed at their 140-cycle worst case). Not measured on hardware.
+
+typedef struct {
+    const char* op;
+    u16 cycles;
+} CycleOp;
+
+static const CycleOp legacyOps[] = {
+    // (velX * 85), ground: shift/add for 64 + 16 + 4 + 1
+    { "move.l d0,d1", 4 }, { "lsl.l #2,d1", 12 }, { "add.l d0,d1", 8 },
+    { "lsl.l #2,d1", 12 }, { "add.l d0,d1", 8 }, { "lsl.l #2,d1", 12 }, { "add.l d0,d1", 8 },
+    // / 100: call __divsi3
+    { "pea 100.w", 16 }, { "move.l d1,-(sp)", 12 }, { "jsr __divsi3", 20 },
+    { "addq.l #8,sp", 8 },
+    // __divsi3: save, load, take signs, call __udivsi3, fix sign
+    { "move.l d2,-(sp)", 12 }, { "move.l 8(sp),d0", 16 }, { "move.l 12(sp),d1", 16 },
+    { "tst.l d0", 4 }, { "bpl.s", 8 }, { "neg.l d0", 6 }, { "moveq #1,d2", 4 },
+    { "move.l d1,-(sp)", 12 }, { "move.l d0,-(sp)", 12 }, { "jsr __udivsi3", 20 },
+    { "addq.l #8,sp", 8 }, { "tst.b d2", 4 }, { "beq.s", 8 }, { "neg.l d0", 6 },
+    { "move.l (sp)+,d2", 12 }, { "rts", 16 },
+    // __udivsi3, divisor below 65536: two divu.w on the halves
+    { "move.l d2,-(sp)", 12 }, { "move.l 8(sp),d0", 16 }, { "move.l 12(sp),d1", 16 },
+    { "move.l d0,d2", 4 }, { "clr.w d2", 4 }, { "swap d2", 4 }, { "divu.w d1,d2", 140 },
+    { "move.w d2,d0", 4 }, { "swap d2", 4 }, { "move.w d0,d2", 4 }, { "divu.w d1,d2", 140 },
+    { "move.l d2,d0", 4 }, { "move.l (sp)+,d2", 12 }, { "rts", 16 },
+    // Dead zone
+    { "cmp.l #102,d0", 14 }, { "bge.s", 10 }, { "cmp.l #-102,d0", 14 }, { "ble.s", 10 },
+};
+
+// After muls.w #coef,d0 (mulsCycles)
+static const CycleOp dampingOps[] = {
+    { "tst.l d0", 4 }, { "bpl.s", 8 }, { "add.l #32767,d0", 16 },
+    { "moveq #15,d1", 4 }, { "asr.l d1,d0", 8 + (2 * DAMPING_SHIFT) },
+    // Dead zone
+    { "cmp.l #102,d0", 14 }, { "bge.s", 10 }, { "cmp.l #-102,d0", 14 }, { "ble.s", 10 },
+};
+
+/**
+ * muls.w #imm,Dn: 38 + 2 per 01/10 bit pair in the 16-bit source (with a
+ * zero appended below it), plus 4 to fetch the immediate.
+ */
+static u16 mulsCycles(s16 source) {
+    u32 bits = ((u16) source) << 1;
+    u16 pairs = 0;
+
+    for (u16 i = 0; i < 16; i++) {
+        if (((bits >> i) ^ (bits >> (i + 1))) & 1) pairs++;
+    }
+    return 38 + (2 * pairs) + 4;
+}
+
+static u16 sumCycles(const CycleOp* ops, u16 count) {
+    u16 total = 0;
+
+    for (u16 i = 0; i < count; i++) total += ops[i].cycles;
+    return total;
+}
+
+#define SUM_CYCLES(ops) sumCycles(ops, sizeof(ops) / sizeof(ops[0]))
+
+static fix32 legacyFriction(fix32 velX, bool onGround) {
+    if (onGround) velX = (velX * 85) / 100;
+    else velX = (velX * 95) / 100;
+
+    if (velX < FIX32(0.1) && velX > FIX32(-0.1)) velX = FIX32(0);
+    return velX;
+}
+
+static fix32 newFriction(fix32 velX, bool onGround) {
+    return dampToRest(velX, onGround ? DAMPING_GROUND : DAMPING_AIR);
+}
+
+/**
+ * Compare single damping steps (before the dead zone) over every 16-bit
+ * velocity, and whole decay runs (damped every frame until at rest).
+ * @return Largest single-step difference in fix32 LSBs
+ */
+static s32 checkEquivalence(bool onGround) {
+    s32 maxDiff = 0;
+    u32 diffCount = 0;
+    u32 stopMismatch = 0;
+    s32 maxStopDelta = 0;
+
+    for (s32 v = -32768; v <= 32767; v++) {
+        s32 legacy = (v * (onGround ? 85 : 95)) / 100;
+        s32 diff = abs(legacy - dampVelocity(v, onGround ? DAMPING_GROUND : DAMPING_AIR));
+        if (diff) diffCount++;
+        if (diff > maxDiff) maxDiff = diff;
+
+        fix32 a = v;
+        fix32 b = v;
+        s32 framesA = 0;
+        s32 framesB = 0;
+        while (a) { a = legacyFriction(a, onGround); framesA++; }
+        while (b) { b = newFriction(b, onGround); framesB++; }
+        if (framesA != framesB) {
+            stopMismatch++;
+            if (abs(framesA - framesB) > maxStopDelta) maxStopDelta = abs(framesA - framesB);
+        }
+    }
+
+    printf("%-6s coef %5d/32768  step: %5u of 65536 differ, max %d LSB  "
+           "decay: %5u stop-frame mismatches, max %d frame\n",
+           onGround ? "ground" : "air", onGround ? DAMPING_GROUND : DAMPING_AIR,
+           diffCount, maxDiff, stopMismatch, maxStopDelta);
+
+    return maxDiff;
+}
+
+static double timeKernel(fix32 (*kernel)(fix32, bool)) {
+    volatile fix32 sink = 0;
+    double start = hostNowSeconds();
+
+    for (u32 round = 0; round < TIMING_ROUNDS; round++) {
+        for (s32 v = -32768; v <= 32767; v++) {
+            sink += kernel(v, v & 1);
+        }
+    }
+
+    (void) sink;
+    return (hostNowSeconds() - start) * 1e9 / (TIMING_ROUNDS * 65536.0);
+}
+
+int main() {
+    s32 worstGround = checkEquivalence(TRUE);
+    s32 worstAir = checkEquivalence(FALSE);
+
+    double legacyNs = timeKernel(legacyFriction);
+    double newNs = timeKernel(newFriction);
+
+    printf("host   legacy %.2f ns/call, damping %.2f ns/call\n", legacyNs, newNs);
+    printf("68000  legacy %u cycles/call, damping %u (ground) / %u (air) cycles/call "
+           "(modelled from instruction timings, not measured)\n",
+           SUM_CYCLES(legacyOps),
+           mulsCycles(DAMPING_GROUND) + SUM_CYCLES(dampingOps),
+           mulsCycles(DAMPING_AIR) + SUM_CYCLES(dampingOps));
+
+    // 1.15 coefficients are within 2^-16 of the exact ratios: one LSB at most
+    return (worstGround <= 1 && worstAir <= 1) ? 0 : 1;
+}
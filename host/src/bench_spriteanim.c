@@ -0,0 +1,149 @@
+#include <genesis.h>
+#include "host.h"
+#include "systems/spriteAnim.h"
+#include "systems/animBatch.h"
+#include "systems/tileAlloc.h"
+#include "systems/transfer.h"
+
+// Sprite frame uploads: naive per-frame upload vs the animation binding.
+// Several instances of one sprite definition loop the same animation at
+// different phases. The naive hookup sends every instance's frame tiles
+// every frame; the binding sends a frame only the first time any instance
+// shows it, and instances on the same frame share its VRAM.
+
+#define FRAMES 600
+#define MAX_INSTANCES 16
+
+typedef struct {
+    const char* name;
+    const SpriteDefinition* def;
+    u16 instances;
+    u16 distinctFrames;     // Upper bound on uploads when everything fits
+} Scenario;
+
+// 32x32 enemy, 4 frames of 16 tiles
+static u32 enemyTileData[4][16 * 8];
+static TileSet enemyTiles[4] = {
+    { COMPRESSION_NONE, 16, enemyTileData[0] },
+    { COMPRESSION_NONE, 16, enemyTileData[1] },
+    { COMPRESSION_NONE, 16, enemyTileData[2] },
+    { COMPRESSION_NONE, 16, enemyTileData[3] },
+};
+static AnimationFrame enemyFrames[4] = {
+    { 1, 6, &enemyTiles[0] }, { 1, 6, &enemyTiles[1] },
+    { 1, 6, &enemyTiles[2] }, { 1, 6, &enemyTiles[3] },
+};
+static AnimationFrame* enemyFrameList[] = { &enemyFrames[0], &enemyFrames[1], &enemyFrames[2], &enemyFrames[3] };
+static Animation enemyWalk = { 4, 1, enemyFrameList };
+static Animation* enemyAnims[] = { &enemyWalk };
+static const SpriteDefinition enemyDef = { 32, 32, NULL, 1, enemyAnims, 16, 1 };
+
+// 48x48 brute, 4 frames of 36 tiles (144 tiles: more than the sprite pool)
+static u32 bruteTileData[4][36 * 8];
+static TileSet bruteTiles[4] = {
+    { COMPRESSION_NONE, 36, bruteTileData[0] },
+    { COMPRESSION_NONE, 36, bruteTileData[1] },
+    { COMPRESSION_NONE, 36, bruteTileData[2] },
+    { COMPRESSION_NONE, 36, bruteTileData[3] },
+};
+static AnimationFrame bruteFrames[4] = {
+    { 4, 6, &bruteTiles[0] }, { 4, 6, &bruteTiles[1] },
+    { 4, 6, &bruteTiles[2] }, { 4, 6, &bruteTiles[3] },
+};
+static AnimationFrame* bruteFrameList[] = { &bruteFrames[0], &bruteFrames[1], &bruteFrames[2], &bruteFrames[3] };
+static Animation bruteWalk = { 4, 1, bruteFrameList };
+static Animation* bruteAnims[] = { &bruteWalk };
+static const SpriteDefinition bruteDef = { 48, 48, NULL, 1, bruteAnims, 36, 4 };
+
+static const AnimSeqFrame walkFrames[] = {
+    { 0, 6, ANIM_EVENT_NONE, 0 }, { 1, 6, ANIM_EVENT_NONE, 0 },
+    { 2, 6, ANIM_EVENT_NONE, 0 }, { 3, 6, ANIM_EVENT_NONE, 0 },
+};
+static const AnimSeq walkAnim = { walkFrames, 4, TRUE };
+
+static SpriteAnim bindings[MAX_INSTANCES];
+
+// Instances showing the same frame must point at the same tiles
+static bool checkSharing(u16 count) {
+    for (u16 i = 0; i < count; i++) {
+        for (u16 j = i + 1; j < count; j++) {
+            Sprite* a = bindings[i].sprite;
+            Sprite* b = bindings[j].sprite;
+            if (a->frameInd == b->frameInd && a->vramTileIndex != b->vramTileIndex) return FALSE;
+            if (a->frameInd != b->frameInd && a->vramTileIndex == b->vramTileIndex) return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static bool runScenario(const Scenario* sc) {
+    u32 naiveTiles = 0;
+    u16 peakUploads = 0;
+    bool shared = TRUE;
+
+    hostReset();
+    SPR_init();
+    tileAllocInit();
+    transferInit();
+    animBatchInit();
+    spriteAnimInit();
+
+    for (u16 i = 0; i < sc->instances; i++) {
+        Sprite* sprite = spriteAnimAddSprite(sc->def, i * 20, 100, 0);
+        spriteAnimBind(&bindings[i], sprite, 0, &walkAnim, i);
+
+        // Spread the instances over the cycle
+        animSeek(bindings[i].anim, i % 4);
+        spriteAnimSync(&bindings[i]);
+    }
+    spriteAnimEndFrame();
+    transferFlush();
+    SYS_doVBlankProcess();
+
+    u32 startUploads = spriteAnimStats.uploads;
+    u32 startTiles = spriteAnimStats.uploadTiles;
+
+    for (u16 frame = 0; frame < FRAMES; frame++) {
+        animBatchUpdate();
+        for (u16 i = 0; i < sc->instances; i++) {
+            spriteAnimSync(&bindings[i]);
+            naiveTiles += sc->def->maxNumTile;
+        }
+        if (!checkSharing(sc->instances)) shared = FALSE;
+
+        spriteAnimEndFrame();
+        if (spriteAnimStats.frameUploads > peakUploads) peakUploads = spriteAnimStats.frameUploads;
+        transferFlush();
+        SYS_doVBlankProcess();
+    }
+
+    u32 uploads = spriteAnimStats.uploads - startUploads;
+    u32 tiles = spriteAnimStats.uploadTiles - startTiles;
+
+    printf("%-26s naive %6.0f tiles/frame  bound %6.2f tiles/frame (%u uploads, peak %u/frame, %u failed)  %s\n",
+           sc->name, (double) naiveTiles / FRAMES, (double) tiles / FRAMES,
+           uploads, peakUploads, spriteAnimStats.failed, shared ? "shared" : "NOT SHARED");
+
+    if (!shared) return FALSE;
+
+    // When every frame fits, nothing is sent after the warm-up
+    return !sc->distinctFrames || uploads == 0;
+}
+
+int main() {
+    static const Scenario scenarios[] = {
+        { "8 x 32px enemy (4x16 t)", &enemyDef, 8, 4 },
+        { "16 x 32px enemy (4x16 t)", &enemyDef, 16, 4 },
+        { "3 x 48px brute (4x36 t)", &bruteDef, 3, 0 },
+    };
+    bool ok = TRUE;
+
+    for (u16 i = 0; i < 3; i++) {
+        if (!runScenario(&scenarios[i])) {
+            printf("  frames re-uploaded or not shared\n");
+            ok = FALSE;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include <genesis.h>
+#include "systems/timerWheel.h"
+
+// Per-frame countdowns vs the timer wheel. Each of N timers is re-armed with
+// a new pseudo-random duration (1-300 frames, like stuns, cooldowns and shot
+// lifetimes) whenever it expires. The countdown side decrements every counter
+// every frame; the wheel only looks at the bucket due. Reports counters
+// touched per frame; every timer must fire on the same frames in both.
+
+#define FRAMES 100000
+#define MAX_DURATION 300
+
+static u16 countdown[TIMER_MAX];
+static u32 seedCountdown[TIMER_MAX];
+static u32 seedWheel[TIMER_MAX];
+
+static u32 countdownFires;
+static u32 countdownSum;
+static u32 wheelFires;
+static u32 wheelSum;
+static u32 frame;
+
+static u16 nextDuration(u32* seed) {
+    *seed = *seed * 1103515245 + 12345;
+    return 1 + (*seed >> 16) % MAX_DURATION;
+}
+
+static void wheelExpire(u16 index) {
+    wheelFires++;
+    wheelSum += frame * (index + 1);
+    timerStart(nextDuration(&seedWheel[index]), wheelExpire, index);
+}
+
+static bool runTimers(u16 count) {
+    u32 decrements = 0;
+
+    timerInit();
+    countdownFires = countdownSum = wheelFires = wheelSum = 0;
+
+    for (u16 i = 0; i < count; i++) {
+        seedCountdown[i] = seedWheel[i] = i * 7919 + 1;
+        countdown[i] = nextDuration(&seedCountdown[i]);
+        timerStart(nextDuration(&seedWheel[i]), wheelExpire, i);
+    }
+
+    for (frame = 1; frame <= FRAMES; frame++) {
+        // Hand-rolled: one branch and decrement per counter per frame
+        for (u16 i = 0; i < count; i++) {
+            decrements++;
+            if (--countdown[i] == 0) {
+                countdownFires++;
+                countdownSum += frame * (i + 1);
+                countdown[i] = nextDuration(&seedCountdown[i]);
+            }
+        }
+
+        timerUpdate();
+    }
+
+    printf("%2u timers  countdowns %5.1f touched/frame  wheel %5.2f visited/frame  fired %u/%u\n",
+           count, (double) decrements / FRAMES, (double) timerStats.visitedTotal / FRAMES,
+           wheelFires, countdownFires);
+
+    return wheelFires == countdownFires && wheelSum == countdownSum && !timerStats.failed;
+}
+
+int main() {
+    static const u16 counts[] = { 8, 16, 32, TIMER_MAX };
+    bool ok = TRUE;
+
+    for (u16 i = 0; i < 4; i++) {
+        if (!runTimers(counts[i])) {
+            printf("  fire frames differ from the countdowns\n");
+            ok = FALSE;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
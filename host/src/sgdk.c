@@ -0,0 +1,390 @@
+#include <genesis.h>
+#include <stdarg.h>
+#include <time.h>
+#include <resources.h>
+#include "host.h"
+
+// Recorder for every stubbed hardware call
+HostRecorder hostRec;
+
+u16 hostHVCounter;
+
+static u16 joyState[JOY_NUM];
+static u16 joyLatched[JOY_NUM];
+static JoyEventCallback* joyCallback = NULL;
+
+static Sprite sprites[HOST_MAX_SPRITES];
+
+static u16 cram[64];
+static u16 dmaQueueBytes;   // Bytes queued since the last vblank
+static u16 fadeFramesLeft;
+
+// ============================================================================
+// Resources (stand-ins for rescomp output)
+// ============================================================================
+
+static u16 backgroundPal[16];
+static u16 foregroundPal[16];
+static u16 spritePal[16];
+
+static Palette backgroundPalette = { 16, backgroundPal };
+static Palette foregroundPalette = { 16, foregroundPal };
+static Palette spritePalette = { 16, spritePal };
+
+// 512x256 and 128x128 images after rescomp tile de-duplication
+static TileSet backgroundTiles = { 0, 640, NULL };
+static TileSet foregroundTiles = { 0, 256, NULL };
+static TileMap backgroundMap = { 0, 64, 32, NULL };
+static TileMap foregroundMap = { 0, 16, 16, NULL };
+
+const Image background = { &backgroundPalette, &backgroundTiles, &backgroundMap };
+const Image foreground = { &foregroundPalette, &foregroundTiles, &foregroundMap };
+
+// 1024x256 level map (uncompressed, streamed from ROM)
+static u16 hubPal[16];
+static u16 hubCells[128 * 32];
+static Palette hubPalette = { 16, hubPal };
+static u32 hubTileData[96 * 8];
+static TileSet hubTiles = { COMPRESSION_NONE, 96, hubTileData };
+static TileMap hubMap = { 0, 128, 32, hubCells };
+
+const Image hubLevel = { &hubPalette, &hubTiles, &hubMap };
+
+// 48x48 sprite (6x6 tiles)
+static u32 spriteTileData[36 * 8];
+static TileSet spriteTiles = { COMPRESSION_NONE, 36, spriteTileData };
+static AnimationFrame spriteFrame = { 4, 0, &spriteTiles };
+static AnimationFrame* spriteFrames[] = { &spriteFrame };
+static Animation spriteAnim = { 1, 1, spriteFrames };
+static Animation* spriteAnims[] = { &spriteAnim };
+const SpriteDefinition pSprite = { 48, 48, &spritePalette, 1, spriteAnims, 36, 4 };
+
+// ============================================================================
+// Host control
+// ============================================================================
+
+void hostReset() {
+    memset(&hostRec, 0, sizeof(hostRec));
+    hostHVCounter = 0;
+    memset(joyState, 0, sizeof(joyState));
+    memset(joyLatched, 0, sizeof(joyLatched));
+    memset(sprites, 0, sizeof(sprites));
+    memset(cram, 0, sizeof(cram));
+    fadeFramesLeft = 0;
+    dmaQueueBytes = 0;
+    joyCallback = NULL;
+}
+
+void hostSetJoypad(u16 joy, u16 state) {
+    if (joy >= JOY_NUM) return;
+    joyState[joy] = state;
+}
+
+double hostNowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ============================================================================
+// Joypad
+// ============================================================================
+
+void JOY_init() {
+    memset(joyLatched, 0, sizeof(joyLatched));
+    joyCallback = NULL;
+}
+
+void JOY_setEventHandler(JoyEventCallback* CB) {
+    joyCallback = CB;
+}
+
+u16 JOY_readJoypad(u16 joy) {
+    hostRec.joyReads++;
+    if (joy >= JOY_NUM) return 0;
+    return joyLatched[joy];
+}
+
+void JOY_update() {
+    for (u16 joy = 0; joy < JOY_NUM; joy++) {
+        u16 changed = joyState[joy] ^ joyLatched[joy];
+        joyLatched[joy] = joyState[joy];
+
+        if (changed && joyCallback) {
+            hostRec.joyEvents++;
+            joyCallback(joy, changed, joyLatched[joy]);
+        }
+    }
+}
+
+// ============================================================================
+// VDP
+// ============================================================================
+
+u16 VDP_getHScrollTableAddress() {
+    return HSCROLL_TABLE_ADDR;
+}
+
+u16 VDP_getPlaneAddress(VDPPlane plane, u16 x, u16 y) {
+    u16 base = (plane == BG_A) ? PLANE_A_ADDR : (plane == BG_B) ? PLANE_B_ADDR : WINDOW_ADDR;
+    return base + (((y * PLANE_W) + x) * 2);
+}
+
+void VDP_loadTileData(const u32* data, u16 index, u16 num, TransferMethod tm) {
+    (void) data; (void) index; (void) tm;
+
+    hostRec.tilesetTiles += num;
+}
+
+TileSet* unpackTileSet(const TileSet* src, TileSet* dest) {
+    if (!dest) dest = MEM_alloc(sizeof(TileSet));
+
+    *dest = *src;
+    dest->compression = COMPRESSION_NONE;
+    hostRec.tileUnpacks++;
+    return dest;
+}
+
+bool VDP_loadTileSet(const TileSet* tileset, u16 index, TransferMethod tm) {
+    (void) index; (void) tm;
+
+    hostRec.tilesetLoads++;
+    hostRec.tilesetTiles += tileset->numTile;
+    return TRUE;
+}
+
+void VDP_setScrollingMode(u16 hscroll, u16 vscroll) {
+    (void) hscroll;
+    (void) vscroll;
+}
+
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value) {
+    hostRec.hscrollWrites++;
+    if (plane <= BG_B) hostRec.hscroll[plane] = value;
+}
+
+void VDP_setVerticalScroll(VDPPlane plane, s16 value) {
+    hostRec.vscrollWrites++;
+    if (plane <= BG_B) hostRec.vscroll[plane] = value;
+}
+
+bool VDP_drawImageEx(VDPPlane plane, const Image* image, u16 basetile, u16 x, u16 y, bool loadpal, bool dma) {
+    (void) plane; (void) basetile; (void) x; (void) y; (void) dma;
+
+    if (!image) return FALSE;
+
+    hostRec.imageDraws++;
+    hostRec.imageTiles += image->tileset->numTile;
+    if (loadpal) hostRec.paletteLoads++;
+    return TRUE;
+}
+
+void VDP_drawText(const char* str, u16 x, u16 y) {
+    (void) x; (void) y;
+
+    hostRec.textDraws++;
+    hostRec.textChars += strlen(str);
+}
+
+VDPPlane VDP_getTextPlane() {
+    return WINDOW;
+}
+
+u16 VDP_getTextPalette() {
+    return PAL0;
+}
+
+u16 VDP_getTextPriority() {
+    return FALSE;
+}
+
+void VDP_clearTextArea(u16 x, u16 y, u16 w, u16 h) {
+    (void) x; (void) y; (void) w; (void) h;
+
+    hostRec.textClears++;
+}
+
+void PAL_setPalette(u16 numPal, const u16* pal, TransferMethod tm) {
+    (void) tm;
+
+    memcpy(cram + (numPal * 16), pal, 16 * 2);
+    hostRec.paletteLoads++;
+}
+
+void PAL_getColors(u16 index, u16* dest, u16 count) {
+    memcpy(dest, cram + index, count * 2);
+}
+
+// Fades complete after numFrame vblanks; only the target colors are kept
+bool PAL_fadeOutAll(u16 numFrame, bool async) {
+    (void) async;
+
+    memset(cram, 0, sizeof(cram));
+    fadeFramesLeft = numFrame;
+    hostRec.paletteFades++;
+    return TRUE;
+}
+
+bool PAL_fadeInAll(const u16* pal, u16 numFrame, bool async) {
+    (void) async;
+
+    memcpy(cram, pal, sizeof(cram));
+    fadeFramesLeft = numFrame;
+    hostRec.paletteFades++;
+    return TRUE;
+}
+
+bool PAL_isDoingFade() {
+    return fadeFramesLeft != 0;
+}
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+void* MEM_alloc(u16 size) {
+    hostRec.memAllocs++;
+    return malloc(size);
+}
+
+void MEM_free(void* ptr) {
+    free(ptr);
+}
+
+// ============================================================================
+// DMA
+// ============================================================================
+
+bool DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step) {
+    (void) location; (void) from; (void) to; (void) step;
+
+    hostRec.dmaQueued++;
+    hostRec.dmaQueuedWords += len;
+    dmaQueueBytes += len * 2;
+    return TRUE;
+}
+
+u16 DMA_getQueueTransferSize() {
+    return dmaQueueBytes;
+}
+
+void DMA_doDma(u8 location, void* from, u16 to, u16 len, s16 step) {
+    (void) location; (void) from; (void) to; (void) step;
+
+    hostRec.dmaImmediate++;
+    hostRec.dmaImmediateWords += len;
+}
+
+// ============================================================================
+// Sprites
+// ============================================================================
+
+void SPR_init() {
+    memset(sprites, 0, sizeof(sprites));
+}
+
+Sprite* SPR_addSpriteEx(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut, u16 flag) {
+    for (u16 i = 0; i < HOST_MAX_SPRITES; i++) {
+        if (!sprites[i].used) {
+            Sprite* sprite = &sprites[i];
+            sprite->definition = spriteDef;
+            sprite->attribut = attribut;
+            sprite->x = x;
+            sprite->y = y;
+            sprite->hflip = FALSE;
+            sprite->used = TRUE;
+            sprite->visibility = VISIBLE;
+            sprite->depth = 0;
+            sprite->flags = flag;
+            sprite->animInd = 0;
+            sprite->frameInd = 0;
+            sprite->vramTileIndex = -1;
+            hostRec.spriteAdds++;
+            return sprite;
+        }
+    }
+    return NULL;
+}
+
+Sprite* SPR_addSprite(const SpriteDefinition* spriteDef, s16 x, s16 y, u16 attribut) {
+    return SPR_addSpriteEx(spriteDef, x, y, attribut,
+                           SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_VRAM_ALLOC |
+                           SPR_FLAG_AUTO_SPRITE_ALLOC | SPR_FLAG_AUTO_TILE_UPLOAD);
+}
+
+void SPR_releaseSprite(Sprite* sprite) {
+    hostRec.spriteReleases++;
+    sprite->used = FALSE;
+}
+
+void SPR_setPosition(Sprite* sprite, s16 x, s16 y) {
+    hostRec.spriteMoves++;
+    sprite->x = x;
+    sprite->y = y;
+}
+
+void SPR_setHFlip(Sprite* sprite, bool value) {
+    hostRec.spriteFlips++;
+    sprite->hflip = value;
+}
+
+void SPR_setVisibility(Sprite* sprite, SpriteVisibility value) {
+    hostRec.spriteVisibility++;
+    sprite->visibility = value;
+}
+
+void SPR_setDepth(Sprite* sprite, s16 value) {
+    hostRec.spriteDepths++;
+    sprite->depth = value;
+}
+
+void SPR_setAnimAndFrame(Sprite* sprite, s16 anim, s16 frame) {
+    hostRec.spriteFrames++;
+    sprite->animInd = anim;
+    sprite->frameInd = frame;
+}
+
+void SPR_setFrame(Sprite* sprite, s16 frame) {
+    hostRec.spriteFrames++;
+    sprite->frameInd = frame;
+}
+
+void SPR_setVRAMTileIndex(Sprite* sprite, s16 value) {
+    sprite->vramTileIndex = value;
+}
+
+void SPR_update() {
+    hostRec.spriteUpdates++;
+}
+
+// ============================================================================
+// System
+// ============================================================================
+
+void SYS_doVBlankProcess() {
+    hostRec.frames++;
+    if (fadeFramesLeft) fadeFramesLeft--;
+    dmaQueueBytes = 0;
+
+    // SGDK polls the pads during vblank and fires the event handler from there
+    JOY_update();
+}
+
+bool SYS_isPAL() {
+    return FALSE;
+}
+
+bool SYS_isNTSC() {
+    return TRUE;
+}
+
+int kprintf(const char* fmt, ...) {
+    va_list args;
+    int len;
+
+    va_start(args, fmt);
+    len = vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+    return len;
+}
@@ -0,0 +1,226 @@
+#include <genesis.h>
+#include "host.h"
+#include "core/game.h"
+#include "entities/player.h"
+#include "camera.h"
+#include "assetLoader.h"
+#include "world/mapStream.h"
+#include "world/zone.h"
+#include "world/zoneLoader.h"
+#include "systems/tileAlloc.h"
+#include "systems/transfer.h"
+#include "systems/scroll.h"
+#include "systems/parallax.h"
+#include "systems/spriteSched.h"
+#include "systems/spriteAnim.h"
+#include "entities/entity.h"
+#include "world/objectSpawner.h"
+#include "systems/hitbox.h"
+#include "gameplay/combat.h"
+#include "systems/timerWheel.h"
+#include "systems/input.h"
+
+// Headless driver: runs the same frame loop as src/main.c against the
+// stub SGDK layer, feeding a deterministic scripted pad sequence.
+
+#define DEFAULT_FRAMES 1000000
+#define TAPE_MAX_WORDS 0x100000
+
+static u16 scriptPad(u32 frame) {
+    u16 phase = frame % 240;
+    u16 pad = (phase < 120) ? BUTTON_RIGHT : BUTTON_LEFT;
+
+    // Jump every second (held for a full jump, the last one tapped for a
+    // short hop), dash, parry and attack on their own beats
+    if ((phase % 60) < (phase < 180 ? 16 : 2)) pad |= BUTTON_B;
+    if ((phase % 90) == 45) pad |= BUTTON_A;
+    if (phase == 200) pad |= BUTTON_C;
+    if ((phase % 40) == 20) pad |= BUTTON_X;
+
+    return pad;
+}
+
+static u16 tape[TAPE_MAX_WORDS];
+
+// Tapes are stored as big-endian words, the way the 68000 reads them
+static bool saveTape(const char* path, u32 length) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return FALSE;
+
+    for (u32 i = 0; i < length; i++) {
+        fputc(tape[i] >> 8, f);
+        fputc(tape[i] & 0xFF, f);
+    }
+    return fclose(f) == 0;
+}
+
+static s32 loadTape(const char* path) {
+    FILE* f = fopen(path, "rb");
+    u32 length = 0;
+    int hi, lo;
+
+    if (!f) return -1;
+    while (length < TAPE_MAX_WORDS && (hi = fgetc(f)) != EOF && (lo = fgetc(f)) != EOF) {
+        tape[length++] = (hi << 8) | lo;
+    }
+    fclose(f);
+    return length;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-n frames] [-a] [-z period] [-Z zone] [-q]\n", prog);
+    fprintf(stderr, "  -n frames  number of frames to simulate (default %d)\n", DEFAULT_FRAMES);
+    fprintf(stderr, "  -a         unlock dash, double jump and parry\n");
+    fprintf(stderr, "  -z period  reload the current zone every period frames\n");
+    fprintf(stderr, "  -Z zone    load this zone (0-6) on the first frame\n");
+    fprintf(stderr, "  -q         only print the final state line\n");
+    fprintf(stderr, "  -r tape    record the pad to a tape file\n");
+    fprintf(stderr, "  -p tape    replay a tape instead of the script (runs its length unless -n)\n");
+}
+
+int main(int argc, char** argv) {
+    u32 frames = DEFAULT_FRAMES;
+    bool abilities = FALSE;
+    bool quiet = FALSE;
+    u32 zonePeriod = 0;
+    u32 zoneLoads = 0;
+    s16 startZone = -1;
+    bool framesSet = FALSE;
+    const char* recordPath = NULL;
+    const char* replayPath = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            frames = strtoul(argv[++i], NULL, 10);
+            framesSet = TRUE;
+        } else if (!strcmp(argv[i], "-a")) {
+            abilities = TRUE;
+        } else if (!strcmp(argv[i], "-z") && i + 1 < argc) {
+            zonePeriod = strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(argv[i], "-Z") && i + 1 < argc) {
+            startZone = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-q")) {
+            quiet = TRUE;
+        } else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    hostReset();
+    gameInit();
+
+    if (abilities) {
+        player.hasDashAbility = TRUE;
+        player.hasDoubleJumpAbility = TRUE;
+        player.hasParryAbility = TRUE;
+    }
+
+    if (startZone >= 0) loadZone(startZone);
+
+    if (replayPath) {
+        s32 length = loadTape(replayPath);
+        if (length < 0) {
+            perror(replayPath);
+            return 1;
+        }
+        inputReplay(tape, length);
+        if (!framesSet) frames = inputTapeFrames(tape, length);
+    } else if (recordPath) {
+        inputRecord(tape, TAPE_MAX_WORDS);
+    }
+
+    double start = hostNowSeconds();
+
+    for (u32 frame = 0; frame < frames; frame++) {
+        hostSetJoypad(JOY_1, scriptPad(frame));
+        if (zonePeriod && frame % zonePeriod == zonePeriod - 1) {
+            loadZone(getCurrentZone());
+            zoneLoads++;
+        }
+
+        // Same order as the ROM main loop
+        gameUpdate();
+        mainCamera();
+        parallaxUpdate();
+        scrollUpdate();
+        spriteSchedUpdate();
+        spriteAnimEndFrame();
+        SPR_update();
+        transferFlush();
+        SYS_doVBlankProcess();
+    }
+
+    double elapsed = hostNowSeconds() - start;
+
+    if (recordPath && !replayPath) {
+        u32 length = inputStopRecording();
+        if (inputTapeStats.overflow || !saveTape(recordPath, length)) {
+            fprintf(stderr, "%s: %s\n", recordPath, inputTapeStats.overflow ? "tape full" : "write failed");
+            return 1;
+        }
+    }
+
+    if (!quiet) {
+        printf("frames      %u in %.3f s (%.0f frames/s)\n",
+               hostRec.frames, elapsed, elapsed > 0 ? hostRec.frames / elapsed : 0.0);
+        printf("joypad      %u reads, %u events\n", hostRec.joyReads, hostRec.joyEvents);
+        printf("input queue %u edges, %u lost, %u actions (%u buffered, %u expired), latency avg %.2f max %u frames\n",
+               inputQueueStats.events, inputQueueStats.overflows, inputQueueStats.actions,
+               inputQueueStats.buffered, inputQueueStats.expired,
+               inputQueueStats.actions ? (double) inputQueueStats.latencyTotal / inputQueueStats.actions : 0.0,
+               inputQueueStats.latencyMax);
+        printf("dma         %u queued (%u words), %u immediate (%u words)\n",
+               hostRec.dmaQueued, hostRec.dmaQueuedWords, hostRec.dmaImmediate, hostRec.dmaImmediateWords);
+        printf("transfer    %u bytes, peak %u/frame, %u carried, %u over budget\n",
+               transferStats.sentBytes, transferStats.peakBytes, transferStats.carried, transferStats.overBudget);
+        printf("stream      %u columns, %u rows, %u refreshes\n",
+               mapStreamStats.columns, mapStreamStats.rows, mapStreamStats.refreshes);
+        if (zoneLoads) {
+            printf("zone load   %u loads, last %u frames (%u working), %u bytes, peak %u/frame\n",
+                   zoneLoads, zoneLoadStats.frames, zoneLoadStats.workFrames,
+                   zoneLoadStats.dmaBytes, zoneLoadStats.maxFrameBytes);
+        }
+        for (u16 pool = 0; pool < TILE_POOL_COUNT; pool++) {
+            TileAllocStats stats;
+            tileAllocGetStats(pool, &stats);
+            printf("vram pool %u %u/%u tiles, largest free %u, %u blocks, frag %u%%\n",
+                   pool, stats.used, stats.size, stats.largestFree, stats.blocks, stats.fragmentation);
+        }
+        printf("entities    %u spawns, %u despawns, peak %u/%u, last frame %u view %u margin %u dormant\n",
+               entityStats.spawns, entityStats.despawns, entityStats.peak, ENTITY_MAX,
+               entityStats.inView, entityStats.inMargin, entityStats.dormant);
+        printf("objects     %u spawns, %u releases, %u collected skips, %u cursor steps\n",
+               objectSpawnerStats.spawns, objectSpawnerStats.releases,
+               objectSpawnerStats.skipped, objectSpawnerStats.cursorSteps);
+        printf("text        %u draws, %u chars\n", hostRec.textDraws, hostRec.textChars);
+        printf("sprites     %u moves, %u flips, %u updates\n",
+               hostRec.spriteMoves, hostRec.spriteFlips, hostRec.spriteUpdates);
+        printf("sprite anim %u frame changes, %u uploads (%u tiles), %u shared\n",
+               spriteAnimStats.changes, spriteAnimStats.uploads,
+               spriteAnimStats.uploadTiles, spriteAnimStats.shared);
+        printf("sprite sched %u overflow frames, %u dropped, %u rotated\n",
+               spriteSchedStats.overflowFrames, spriteSchedStats.droppedTotal, spriteSchedStats.rotatedTotal);
+        if (recordPath || replayPath) {
+            printf("input tape  %s %u frames, %u runs, %u words (%u bytes)%s\n",
+                   replayPath ? "replayed" : "recorded", inputTapeStats.frames, inputTapeStats.runs,
+                   inputTapeStats.words, inputTapeStats.words * 2, inputTapeStats.ended ? ", ran out" : "");
+        }
+        printf("timers      %u fired, %u cancelled, peak %u/%u, %.2f visited/frame, %u failed\n",
+               timerStats.fired, timerStats.cancelled, timerStats.peak, TIMER_MAX,
+               (double) timerStats.visitedTotal / frames, timerStats.failed);
+        printf("combat      %u defeats, %u player hits, %u parries, %.1f box tests/frame (peak %u), %u dropped\n",
+               combatStats.defeats, combatStats.playerHits, combatStats.parries,
+               (double) hitboxStats.testsTotal / frames, hitboxStats.peakTests, hitboxStats.dropped);
+    }
+
+    printf("player      x=%d y=%d vx=%d vy=%d state=%d hp=%u sp=%u ground=%u\n",
+           (int) player.posX, (int) player.posY, (int) player.velX, (int) player.velY,
+           player.currentState, player.health, player.stamina, player.onGround);
+
+    return 0;
+}
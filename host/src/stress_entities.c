@@ -0,0 +1,189 @@
+#include <genesis.h>
+#include "host.h"
+#include "core/game.h"
+#include "entities/entity.h"
+#include "entities/player.h"
+#include "camera.h"
+
+// Entity pool churn: spawns and despawns thousands of enemies, pickups and
+// projectiles per simulated second on top of a running game, and checks
+// that stale handles never resolve, the free list never loses or duplicates
+// a slot, and nothing calls MEM_alloc. A second pass spreads a full pool
+// across a wide zone and checks that update calls follow the camera window.
+
+#define FRAMES 60000
+#define CHURN_ROUNDS 4              // Despawn/refill rounds per frame
+#define SPAWNS_PER_ROUND 64         // Attempts per round (the pool refuses past ENTITY_MAX)
+#define MIN_SPAWNS_PER_SECOND 4000  // At 60 fps; the churn must reach this load
+#define HELD_MAX ENTITY_MAX
+#define STALE_RING 256
+#define SPREAD_WIDTH 4096
+#define SPREAD_FRAMES 600
+
+static EntityHandle held[HELD_MAX];
+static u16 heldCount;
+
+static EntityHandle stale[STALE_RING];
+static u16 staleHead;
+
+static u32 errors;
+static u32 rng = 4242;
+
+static u16 nextRandom() {
+    rng = rng * 1103515245 + 12345;
+    return (rng >> 16) & 0x7FFF;
+}
+
+static void fail(const char* what, u32 frame) {
+    if (errors++ < 10) printf("frame %u: %s\n", frame, what);
+}
+
+static void rememberStale(EntityHandle handle) {
+    stale[staleHead] = handle;
+    staleHead = (staleHead + 1) % STALE_RING;
+}
+
+// Drop handles whose entity went away on its own (expired, collected)
+static void pruneHeld() {
+    for (u16 i = 0; i < heldCount; ) {
+        if (!entityGet(held[i])) {
+            rememberStale(held[i]);
+            held[i] = held[--heldCount];
+        } else {
+            i++;
+        }
+    }
+}
+
+static void churn(u32 frame) {
+    // Despawn about half of what we hold, in random order
+    for (u16 n = heldCount / 2; n; n--) {
+        u16 i = nextRandom() % heldCount;
+
+        entityDespawn(held[i]);
+        if (entityGet(held[i])) fail("handle resolves after despawn", frame);
+
+        // A second despawn through the same handle must be a no-op
+        u8 active = entityStats.active;
+        entityDespawn(held[i]);
+        if (entityStats.active != active) fail("double despawn freed a slot", frame);
+
+        rememberStale(held[i]);
+        held[i] = held[--heldCount];
+    }
+
+    for (u16 n = 0; n < SPAWNS_PER_ROUND; n++) {
+        EntityType type = ENTITY_TYPE_ENEMY + (nextRandom() % (ENTITY_TYPE_COUNT - 1));
+        fix32 x = FIX32(64 + (nextRandom() % 512));
+        fix32 y = FIX32(32 + (nextRandom() % 160));
+        s16 param = (nextRandom() & 1) ? 2 : -2;
+
+        EntityHandle h = entitySpawn(type, x, y, param);
+        if (h == ENTITY_NONE) {
+            if (entityStats.active != ENTITY_MAX) fail("spawn refused with free slots", frame);
+            break;
+        }
+
+        Entity* e = entityGet(h);
+        if (!e || e->type != type) fail("fresh handle does not resolve", frame);
+        if (heldCount < HELD_MAX) held[heldCount++] = h;
+        else fail("more live handles than slots", frame);
+    }
+}
+
+static void checkStale(u32 frame) {
+    for (u16 i = 0; i < STALE_RING; i++) {
+        if (stale[i] != ENTITY_NONE && entityGet(stale[i])) fail("stale handle resolves", frame);
+    }
+}
+
+// Empty the pool, then fill it exactly: any leaked or doubled free-list
+// entry shows up as a short or long fill
+static bool checkFreeList() {
+    entityDespawnAll();
+    if (entityStats.active) return FALSE;
+
+    for (u16 i = 0; i < ENTITY_MAX; i++) {
+        EntityHandle h = entitySpawn(ENTITY_TYPE_PICKUP, FIX32(0), FIX32(0), 0);
+        if (h == ENTITY_NONE) return FALSE;
+        for (u16 j = 0; j < i; j++) {
+            if (ENTITY_HANDLE_INDEX(held[j]) == ENTITY_HANDLE_INDEX(h)) return FALSE;
+        }
+        held[i] = h;
+    }
+    bool full = entitySpawn(ENTITY_TYPE_PICKUP, FIX32(0), FIX32(0), 0) == ENTITY_NONE;
+
+    entityDespawnAll();
+    heldCount = 0;
+    return full && !entityStats.active;
+}
+
+// Full pool of enemies across the zone, camera panning through it
+static void checkActivation() {
+    u32 updates = 0;
+    u32 inView = 0;
+    u32 inMargin = 0;
+
+    entityDespawnAll();
+    for (u16 i = 0; i < ENTITY_MAX; i++) {
+        entitySpawn(ENTITY_TYPE_ENEMY, FIX32(i * (SPREAD_WIDTH / ENTITY_MAX)), FIX32(96), 1);
+    }
+
+    for (u16 frame = 0; frame < SPREAD_FRAMES; frame++) {
+        currentCameraX = frame * ((SPREAD_WIDTH - SCREEN_WIDTH) / SPREAD_FRAMES);
+        entityUpdateAll();
+        updates += entityStats.updates;
+        inView += entityStats.inView;
+        inMargin += entityStats.inMargin;
+    }
+
+    // Every in-view entity each frame plus a quarter of the margin band, at most
+    u32 bound = inView + (inMargin + ENTITY_MARGIN_TICK - 1) / ENTITY_MARGIN_TICK + SPREAD_FRAMES;
+    if (updates > bound) fail("update calls exceed the activation window", SPREAD_FRAMES);
+
+    printf("activation: %u entities over %u px  %.1f updates/frame  (%.1f in view, %.1f in margin)\n",
+           ENTITY_MAX, SPREAD_WIDTH, (double) updates / SPREAD_FRAMES,
+           (double) inView / SPREAD_FRAMES, (double) inMargin / SPREAD_FRAMES);
+
+    entityDespawnAll();
+    currentCameraX = 0;
+}
+
+int main() {
+    hostReset();
+    gameInit();
+
+    // Keep the player out of the spawn area so pickups aren't collected at once
+    player.posX = FIX32(0);
+    player.posY = FIX32(0);
+
+    u32 allocsBefore = hostRec.memAllocs;
+    double poolSeconds = 0;
+
+    for (u32 frame = 0; frame < FRAMES; frame++) {
+        double start = hostNowSeconds();
+        for (u16 round = 0; round < CHURN_ROUNDS; round++) churn(frame);
+        entityUpdateAll();
+        entityDrawAll();
+        poolSeconds += hostNowSeconds() - start;
+
+        pruneHeld();
+        if (entityStats.active != heldCount) fail("active count drifted from live handles", frame);
+        if ((frame & 63) == 0) checkStale(frame);
+    }
+
+    checkActivation();
+    if (!checkFreeList()) fail("free list does not hold exactly ENTITY_MAX slots", FRAMES);
+    if (hostRec.memAllocs != allocsBefore) fail("MEM_alloc called by the entity pool", FRAMES);
+
+    u32 spawnsPerSecond = entityStats.spawns / (FRAMES / 60);
+    if (spawnsPerSecond < MIN_SPAWNS_PER_SECOND) fail("churn below the target spawn rate", FRAMES);
+
+    printf("%u frames  spawns %u (%u/s at 60 fps)  despawns %u  refused %u  peak %u/%u\n",
+           FRAMES, entityStats.spawns, spawnsPerSecond,
+           entityStats.despawns, entityStats.failed, entityStats.peak, ENTITY_MAX);
+    printf("pool time %.0f ns/frame  MEM_alloc calls %u  errors %u\n",
+           poolSeconds * 1e9 / FRAMES, hostRec.memAllocs - allocsBefore, errors);
+
+    return errors ? 1 : 0;
+}
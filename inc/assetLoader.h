@@ -5,15 +5,13 @@
 
 // Declare the global variables that will be used across files.
 // Use 'extern' to indicate that they are defined 
-extern u16 ind;
-extern int scrollBackground_offset;
-extern int scrollForeground_offset;
+extern u16 backgroundTileIndex;    // BG_B tiles (TILE_POOL_ZONE)
+extern u16 levelTileIndex;         // Zone level tiles (TILE_POOL_ZONE)
 extern Sprite *playerSprite;
  
 // Declare the functions...
 void initializeAssets();
 void loadPlayerAssets();
 void loadLevelAssets();
-void updateBackgroundScroll();
 
 #endif // ASSET_LOADER_H
\ No newline at end of file
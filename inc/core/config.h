@@ -10,16 +10,28 @@
 // Physics constants
 #define GRAVITY FIX32(0.5)
 #define MAX_FALL_SPEED FIX32(8.0)
-#define GROUND_FRICTION FIX32(0.85)
-#define AIR_FRICTION FIX32(0.95)
+#define GROUND_FRICTION_FACTOR 0.85
+#define AIR_FRICTION_FACTOR 0.95
+#define GROUND_FRICTION FIX32(GROUND_FRICTION_FACTOR)
+#define AIR_FRICTION FIX32(AIR_FRICTION_FACTOR)
 
 // Player constants
 #define PLAYER_WALK_SPEED FIX32(2.0)
 #define PLAYER_RUN_SPEED FIX32(4.0)
-#define PLAYER_JUMP_VELOCITY FIX32(-8.0)
-#define PLAYER_DASH_DISTANCE 32  // pixels
-#define PLAYER_DASH_DURATION 8   // frames
+#define PLAYER_MAX_SPEED_X FIX32(8.0)  // Dash speed, fastest horizontal move
+#define PLAYER_DASH_COOLDOWN 30  // frames from the start of a dash to the next
 #define PLAYER_PARRY_WINDOW 20   // frames
+#define PLAYER_HURT_DURATION 30  // frames stunned (and not hit again) after a hit
+#define PLAYER_HURT_KNOCKBACK FIX32(3.0)
+#define PLAYER_HITBOX_WIDTH 16   // pixels
+#define PLAYER_HITBOX_HEIGHT 44  // pixels (feet 4px above the 48px sprite bottom)
+
+// Input buffering: frames a press keeps retrying its action after the frame
+// it was made on (0: only that frame)
+#define INPUT_BUFFER_JUMP 6      // Jump pressed just before landing
+#define INPUT_BUFFER_DASH 4
+#define INPUT_BUFFER_PARRY 2
+#define INPUT_BUFFER_ATTACK 8    // Next attack queued during recovery
 
 // Game constants
 #define TARGET_FPS 60
@@ -33,5 +45,6 @@
 #define ZONE_HUB 4
 #define ZONE_BIOS 5
 #define ZONE_RESERVED 6
+#define ZONE_COUNT 7
 
 #endif // CONFIG_H
@@ -0,0 +1,121 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <genesis.h>
+
+// Per-system frame profiler.
+// Samples the VDP H/V counter around each stage of the frame. Only compiled
+// into DEBUG builds (or with PROFILE_ENABLED); otherwise the PROF_* macros
+// expand to nothing and cost zero cycles.
+
+#if defined(DEBUG) && !defined(PROFILE_ENABLED)
+#define PROFILE_ENABLED
+#endif
+
+#define PROF_HISTORY 64         // Frames kept in the min/avg/max ring buffer
+#define PROF_TICKS_PER_LINE 210 // H counter ticks per scanline in H40 mode
+#define PROF_BAR_ROW 4          // First text row used by the budget bars
+#define PROF_LINES_PER_CHAR 8   // Scanlines represented by one bar character
+
+typedef enum {
+    // main() loop stages
+    PROF_GAME_UPDATE,
+    PROF_CAMERA,
+    PROF_BG_SCROLL,
+    PROF_SPR_UPDATE,
+    PROF_TRANSFER,
+    PROF_VBLANK,
+
+    // gameUpdate() stages
+    PROF_INPUT,
+    PROF_ANIM,
+    PROF_PLAYER,
+    PROF_PHYSICS,
+    PROF_TIMERS,
+    PROF_ENTITIES,
+    PROF_COMBAT,
+    PROF_HUD_UPDATE,
+    PROF_HUD_RENDER,
+
+    // Whole loop iteration
+    PROF_FRAME,
+
+    PROF_SECTION_COUNT
+} ProfSection;
+
+/**
+ * @brief Timing summary for one section over the ring buffer
+ *
+ * All values are in H counter ticks (PROF_TICKS_PER_LINE per scanline,
+ * about 2.3 68000 cycles per tick).
+ */
+typedef struct {
+    u16 min;
+    u16 avg;
+    u16 max;
+    u16 last;
+} ProfStats;
+
+#ifdef PROFILE_ENABLED
+
+#define PROF_FRAME_BEGIN() profFrameBegin()
+#define PROF_FRAME_END() profFrameEnd()
+#define PROF_BEGIN(section) profBegin(section)
+#define PROF_END(section) profEnd(section)
+
+#else
+
+#define PROF_FRAME_BEGIN() ((void) 0)
+#define PROF_FRAME_END() ((void) 0)
+#define PROF_BEGIN(section) ((void) 0)
+#define PROF_END(section) ((void) 0)
+
+#endif // PROFILE_ENABLED
+
+/**
+ * @brief Reset history and detect NTSC/PAL line count
+ */
+void profInit();
+
+/**
+ * @brief Mark the start of a main loop iteration
+ */
+void profFrameBegin();
+
+/**
+ * @brief Mark the end of a main loop iteration and commit it to the history
+ */
+void profFrameEnd();
+
+/**
+ * @brief Start timing a section
+ * @param section Section to time
+ */
+void profBegin(ProfSection section);
+
+/**
+ * @brief Stop timing a section (accumulates if a section runs several times)
+ * @param section Section to time
+ */
+void profEnd(ProfSection section);
+
+/**
+ * @brief Get min/avg/max for a section over the last PROF_HISTORY frames
+ * @param section Section to query
+ * @param stats Output summary
+ */
+void profGetStats(ProfSection section, ProfStats* stats);
+
+/**
+ * @brief Draw scanline budget bars on the text plane
+ *
+ * Redraws one row per call so the bars don't eat the budget they measure.
+ */
+void profDrawBars();
+
+/**
+ * @brief Dump min/avg/max of every section to the debug log (KLog)
+ */
+void profDump();
+
+#endif // PROFILER_H
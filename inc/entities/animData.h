@@ -0,0 +1,15 @@
+// Generated by tools/bakeboxes from res/anims.boxes - do not edit
+
+#ifndef ANIM_DATA_H
+#define ANIM_DATA_H
+
+#include <genesis.h>
+#include "systems/animBatch.h"
+
+extern const AnimSeq playerIdleSeq;
+extern const AnimSeq playerAttackSeq;
+extern const AnimSeq playerParrySeq;
+extern const FrameBoxes enemyBoxes;
+extern const FrameBoxes projectileBoxes;
+
+#endif // ANIM_DATA_H
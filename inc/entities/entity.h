@@ -0,0 +1,183 @@
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include <genesis.h>
+#include "core/config.h"
+#include "systems/animBatch.h"
+#include "systems/timerWheel.h"
+#include "systems/stateMachine.h"
+
+// Fixed-capacity entity pool.
+// Every non-player actor (enemies, pickups, projectiles) lives in one static
+// slot array. Free slots form a singly linked list, so spawn and despawn are
+// O(1) and never touch the heap. Handles carry a generation count, so a
+// handle to a despawned entity is detected instead of aliasing whatever
+// reused its slot (until the slot's 8-bit generation wraps, 255 spawns later).
+//
+// Activation: each frame an entity is classed against the camera. In view it
+// updates and draws every frame; in the margin band around the view it
+// updates every ENTITY_MARGIN_TICK frames with its sprite hidden; beyond that
+// it is dormant (no update, no draw, sprite hidden) and only re-checked every
+// ENTITY_DORMANT_RECHECK frames. Update cost follows what is near the player,
+// not how many entities the zone holds.
+
+#define ENTITY_MAX 48
+#define ENTITY_NONE 0           // Never a valid handle (generation 0 is skipped)
+#define ENTITY_SLOT_NONE 0xFF
+
+// Activation window around the camera, in pixels
+#define ENTITY_VIEW_SLACK 32        // Entity positions are top-left; covers the sprite size
+#define ENTITY_MARGIN 96            // Band past the view where entities keep running
+#define ENTITY_MARGIN_TICK 4        // Margin entities update every Nth frame (power of 2)
+#define ENTITY_DORMANT_RECHECK 8    // Dormant entities are re-classed every Nth frame (power of 2)
+
+// Handle layout: generation in the high byte, slot index in the low byte
+#define ENTITY_HANDLE(index, generation) ((EntityHandle) (((generation) << 8) | (index)))
+#define ENTITY_HANDLE_INDEX(handle) ((handle) & 0xFF)
+#define ENTITY_HANDLE_GENERATION(handle) ((handle) >> 8)
+
+typedef u16 EntityHandle;
+
+typedef enum {
+    ENTITY_TYPE_NONE,       // Free slot
+    ENTITY_TYPE_ENEMY,
+    ENTITY_TYPE_PICKUP,
+    ENTITY_TYPE_PROJECTILE,
+    ENTITY_TYPE_COUNT
+} EntityType;
+
+// Enemy states (table in entityTypes.c)
+typedef enum {
+    ENEMY_STATE_WALK,
+    ENEMY_STATE_RECOIL,     // Parried: backs off fast, can't be turned again
+    ENEMY_STATE_COUNT
+} EnemyState;
+
+typedef enum {
+    ENTITY_IN_VIEW,
+    ENTITY_IN_MARGIN,
+    ENTITY_DORMANT
+} EntityActivity;
+
+typedef struct {
+    fix32 posX;
+    fix32 posY;
+    fix32 velX;
+    fix32 velY;
+
+    u8 type;                // EntityType
+    u8 generation;          // Bumped on every spawn into this slot
+    u8 nextFree;            // Free list link while the slot is free
+    bool facingRight;
+
+    u8 activity;            // EntityActivity
+    u8 elapsed;             // Frames covered by this update (1 in view, up to ENTITY_MARGIN_TICK)
+    u8 layoutIndex;         // Zone object it was spawned from, ENTITY_SLOT_NONE if none
+    u8 state;               // Index into the type's state table (starts at 0, enter not run)
+
+    TimerHandle timer;      // Per-type countdown (lifetime, ...), cancelled on despawn
+    s16 param;              // Per-type value given at spawn
+
+    Sprite* sprite;         // Optional, positioned by the type's draw function
+} Entity;
+
+typedef void EntityFunc(Entity* entity);
+
+/**
+ * @brief Per-type behaviour, indexed by EntityType
+ */
+typedef struct {
+    EntityFunc* spawn;      // Optional setup after the common fields are set
+    EntityFunc* update;     // Each active tick; should advance by entity->elapsed frames
+    EntityFunc* draw;       // After the camera has moved, in view only
+    const FrameBoxes* boxes;    // Hurtboxes/hitboxes baked from res/anims.boxes (NULL: none)
+    u8 width;                   // Collision width; left-facing boxes mirror across it
+    const StateDef* states;     // State table (NULL: stateless)
+} EntityTypeInfo;
+
+extern const EntityTypeInfo entityTypes[ENTITY_TYPE_COUNT];
+
+/**
+ * @brief Pool counters
+ */
+typedef struct {
+    u8 active;
+    u8 peak;
+    u32 spawns;
+    u32 despawns;
+    u32 failed;             // Spawns refused because the pool was full
+    u32 staleLookups;       // entityGet() calls with an outdated handle
+
+    // Last entityUpdateAll() pass
+    u8 inView;
+    u8 inMargin;
+    u8 dormant;
+    u8 updates;             // Update functions actually called
+} EntityPoolStats;
+
+extern EntityPoolStats entityStats;
+
+/**
+ * @brief Free every slot and rebuild the free list
+ */
+void entityPoolInit();
+
+/**
+ * @brief Take a slot from the free list
+ * @param type Entity type
+ * @param posX Initial X position
+ * @param posY Initial Y position
+ * @param param Per-type value (speed, item kind, ...)
+ * @return Handle, or ENTITY_NONE if the pool is full
+ */
+EntityHandle entitySpawn(EntityType type, fix32 posX, fix32 posY, s16 param);
+
+/**
+ * @brief Return an entity's slot to the free list (stale handles are ignored)
+ * @param handle Handle from entitySpawn()
+ */
+void entityDespawn(EntityHandle handle);
+
+/**
+ * @brief Despawn every live entity (zone change); outstanding handles go stale
+ */
+void entityDespawnAll();
+
+/**
+ * @brief Resolve a handle
+ * @param handle Handle from entitySpawn()
+ * @return Entity, or NULL if it has been despawned
+ */
+Entity* entityGet(EntityHandle handle);
+
+/**
+ * @brief Handle of a live entity (for despawning from inside update)
+ * @param entity Entity in the pool
+ */
+EntityHandle entityHandleOf(const Entity* entity);
+
+/**
+ * @brief Change an entity's state through its type's state table
+ * @param entity Entity in the pool
+ * @param state State to change to
+ * @return TRUE if changed (FALSE if refused or the type has no states)
+ */
+bool entitySetState(Entity* entity, u8 state);
+
+/**
+ * @brief Class every live entity against the camera and run the updates due
+ */
+void entityUpdateAll();
+
+/**
+ * @brief Run the draw function of every entity in view
+ */
+void entityDrawAll();
+
+/**
+ * @brief Submit the boxes of every entity in view to the hitbox stage
+ * @param team Hitbox team for all entities (hit handlers get entity handles)
+ */
+void entitySubmitHitboxes(u8 team);
+
+#endif // ENTITY_H
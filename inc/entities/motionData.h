@@ -0,0 +1,14 @@
+// Generated by tools/bakecurves from res/motion.curves - do not edit
+
+#ifndef MOTION_DATA_H
+#define MOTION_DATA_H
+
+#include <genesis.h>
+#include "systems/motion.h"
+
+extern const MotionCurve playerJumpRise;
+extern const MotionCurve playerJumpCutRise;
+extern const MotionCurve playerDoubleJumpRise;
+extern const MotionCurve playerDashCurve;
+
+#endif // MOTION_DATA_H
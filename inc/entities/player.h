@@ -3,6 +3,9 @@
 
 #include <genesis.h>
 #include "core/config.h"
+#include "systems/spriteAnim.h"
+#include "systems/timerWheel.h"
+#include "systems/motion.h"
 
 typedef enum {
     PLAYER_STATE_IDLE,
@@ -14,7 +17,8 @@ typedef enum {
     PLAYER_STATE_PARRYING,
     PLAYER_STATE_BLOCKING,
     PLAYER_STATE_HURT,
-    PLAYER_STATE_DEAD
+    PLAYER_STATE_DEAD,
+    PLAYER_STATE_COUNT
 } PlayerState;
 
 typedef struct {
@@ -30,26 +34,40 @@ typedef struct {
     u16 stamina;
     u16 maxStamina;
     
-    // State
-    PlayerState currentState;
+    // State (PlayerState; transitions follow the table in player.c)
+    u8 currentState;
     bool onGround;
     bool facingRight;
     
     // Abilities
-    bool canDash;
-    u16 dashCooldown;
-    u16 dashTimer;
+    // Jump and dash motion follow baked curves (res/motion.curves)
+    const MotionCurve* rise;    // Jump curve while rising, NULL once gravity has it
+    u8 riseFrame;
+    u8 dashFrame;
+    
+    // Countdowns run on the timer wheel (systems/timerWheel)
+    bool canDash;               // Set again by the cooldown timer
+    TimerHandle dashCooldown;
+    TimerHandle dashTimer;
     bool hasDashAbility;
     
     bool canDoubleJump;
     bool hasDoubleJumpAbility;
     
-    u16 parryWindow;
+    TimerHandle parryWindow;
     bool hasParryAbility;
     
+    TimerHandle hurtTimer;
+    
     // Sprite reference (SGDK sprite pointer)
     Sprite* sprite;
     
+    // Animation bound to the sprite (tiles uploaded on frame change only)
+    SpriteAnim anim;
+    
+    // Physics body slot (systems/physicsBatch)
+    u8 body;
+    
 } Player;
 
 extern Player player;
@@ -61,37 +79,60 @@ extern Player player;
 void playerInit();
 
 /**
- * @brief Updates player position and state
+ * @brief Updates player state ahead of the physics stage
  * 
- * Called every frame to handle player physics,
- * state transitions, and collision detection.
+ * Called every frame to handle ground collision and landing,
+ * then hands velocity and physics flags to the player's body.
  */
 void playerUpdate();
 
 /**
- * @brief Change player state with validation
+ * @brief Finish the player update after the physics stage
+ * 
+ * Pulls position/velocity back from the body, then runs
+ * state updates, bounds and the sprite position update.
+ */
+void playerPostPhysics();
+
+/**
+ * @brief Change player state if the current state allows it
  * @param newState The state to transition to
+ * @return TRUE if the state changed
  */
-void setPlayerState(PlayerState newState);
+bool setPlayerState(PlayerState newState);
 
 // Movement functions
 void movePlayerLeft();
 void movePlayerRight();
-void playerJump();
-void playerDash();
+bool playerJump();
+bool playerDash();
 
 // Combat functions
-void playerParry();
-void playerAttack();
+bool playerParry();
+bool playerAttack();
+
+/**
+ * @brief Take a hit: damage, knockback and a short stun (ignored while
+ *        dashing, hurt or dead)
+ * @param damage Health lost
+ * @param knockRight Push the player to the right
+ * @return TRUE if the hit landed
+ */
+bool playerHurt(u16 damage, bool knockRight);
+
+/**
+ * @brief Box set of the player's current animation frame
+ */
+const FrameBoxes* playerBoxes();
 
 // Input handling functions
 /**
- * @brief Handle button press events
- * @param joy Joystick number
- * @param changed Buttons that changed state
- * @param state Current button state
+ * @brief Map the action buttons to the player (jump, dash, parry, attack)
+ *
+ * Presses reach the actions through the input queue; each action returns
+ * TRUE once it takes effect, so a press made too early stays buffered.
  */
-void playerJoyEvent(u16 joy, u16 changed, u16 state);
+void playerBindInput();
 
 /**
  * @brief Handle continuous input (D-pad) each frame
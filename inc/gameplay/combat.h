@@ -0,0 +1,41 @@
+#ifndef COMBAT_H
+#define COMBAT_H
+
+#include <genesis.h>
+
+// Combat rules on top of the hitbox stage (systems/hitbox).
+// Each frame the player and every entity in view submit the boxes of the
+// frame they are showing. Player hits defeat entities (defeated zone objects
+// stay down); entity hits hurt the player, unless a parry is up, in which
+// case enemies are turned back and shots are destroyed.
+
+#define COMBAT_PLAYER_ID 0          // ENTITY_NONE: never a live entity handle
+#define COMBAT_CONTACT_DAMAGE 10
+
+typedef enum {
+    COMBAT_TEAM_PLAYER,
+    COMBAT_TEAM_ENEMY
+} CombatTeam;
+
+/**
+ * @brief Outcome counters
+ */
+typedef struct {
+    u32 defeats;
+    u32 playerHits;
+    u32 parries;
+} CombatStats;
+
+extern CombatStats combatStats;
+
+/**
+ * @brief Reset the hitbox stage and the counters
+ */
+void combatInit();
+
+/**
+ * @brief Gather this frame's boxes and apply the hits (after entity updates)
+ */
+void combatUpdate();
+
+#endif // COMBAT_H
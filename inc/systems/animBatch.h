@@ -0,0 +1,179 @@
+#ifndef ANIM_BATCH_H
+#define ANIM_BATCH_H
+
+#include <genesis.h>
+
+// Batched animation stage.
+// Every running animation owns a slot; the sequence pointer, frame cursor,
+// timer and flags live in parallel arrays (8 bytes per slot) so one loop per
+// frame advances all of them. Sequences are ROM tables of frames with their
+// own durations and an optional event (hitbox on/off, footstep, ...) that is
+// dispatched once, when the frame is entered.
+
+#define ANIM_MAX_SLOTS 32
+#define ANIM_SLOT_NONE 0xFF
+#define ANIM_HOLD 0             // Frame duration: stay on this frame until told otherwise
+
+// Slot flags
+#define ANIM_ACTIVE     0x01    // Slot in use
+#define ANIM_LOOP       0x02    // Wrap to the first frame after the last
+#define ANIM_FINISHED   0x04    // Non-looping sequence reached its last frame
+#define ANIM_CHANGED    0x08    // Frame changed in the last update (or on play)
+#define ANIM_PAUSED     0x10    // Skipped by animBatchUpdate()
+
+typedef enum {
+    ANIM_EVENT_NONE,
+    ANIM_EVENT_HITBOX_ON,       // arg: hitbox id
+    ANIM_EVENT_HITBOX_OFF,      // arg: hitbox id
+    ANIM_EVENT_FOOTSTEP,        // arg: sound id
+    ANIM_EVENT_COUNT
+} AnimEvent;
+
+/**
+ * @brief One frame of a sequence (ROM)
+ */
+typedef struct {
+    u8 frame;           // Frame index in the sprite definition's animation
+    u8 duration;        // Updates to hold it (ANIM_HOLD: forever)
+    u8 event;           // AnimEvent fired on entering the frame
+    u8 arg;             // Event argument
+} AnimSeqFrame;
+
+/**
+ * @brief Hurtbox or hitbox relative to the actor, facing right (ROM)
+ */
+typedef struct {
+    s8 x;
+    s8 y;
+    u8 width;
+    u8 height;
+} FrameBox;
+
+/**
+ * @brief Boxes of one frame: hurtCount hurtboxes, then hitCount hitboxes (ROM)
+ */
+typedef struct {
+    const FrameBox* boxes;
+    u8 hurtCount;
+    u8 hitCount;
+} FrameBoxes;
+
+/**
+ * @brief A frame sequence (ROM)
+ */
+typedef struct {
+    const AnimSeqFrame* frames;
+    u8 count;
+    bool loop;
+    const FrameBoxes* boxes;    // One per frame, baked from res/anims.boxes (NULL: none)
+} AnimSeq;
+
+typedef struct {
+    const AnimSeq* seq[ANIM_MAX_SLOTS];
+    u8 cursor[ANIM_MAX_SLOTS];      // Index into seq->frames
+    u8 timer[ANIM_MAX_SLOTS];       // Updates left on the current frame (0: holding)
+    u8 flags[ANIM_MAX_SLOTS];
+    u8 owner[ANIM_MAX_SLOTS];       // Caller's id, passed to event handlers
+    u8 highWater;                   // One past the highest slot ever used
+} AnimSlots;
+
+extern AnimSlots animSlots;
+
+/**
+ * @brief Frame event callback
+ * @param anim Slot that entered the frame
+ * @param owner Owner id given to animAdd()
+ * @param arg Event argument from the frame
+ */
+typedef void AnimEventHandler(u8 anim, u8 owner, u8 arg);
+
+/**
+ * @brief Event counters
+ */
+typedef struct {
+    u32 transitions;    // Frame changes
+    u32 events;         // Events dispatched to a handler
+} AnimBatchStats;
+
+extern AnimBatchStats animBatchStats;
+
+/**
+ * @brief Clear all slots and event handlers
+ */
+void animBatchInit();
+
+/**
+ * @brief Set the handler for one event type (NULL to ignore it)
+ * @param event Event type
+ * @param handler Callback
+ */
+void animSetEventHandler(AnimEvent event, AnimEventHandler* handler);
+
+/**
+ * @brief Claim a slot and start a sequence on it
+ * @param seq Sequence (ROM)
+ * @param owner Caller's id for event handlers
+ * @return Slot index, or ANIM_SLOT_NONE if all slots are taken
+ */
+u8 animAdd(const AnimSeq* seq, u8 owner);
+
+/**
+ * @brief Release a slot
+ * @param anim Slot from animAdd()
+ */
+void animRemove(u8 anim);
+
+/**
+ * @brief Start a sequence from its first frame (fires that frame's event)
+ * @param anim Slot from animAdd()
+ * @param seq Sequence (ROM)
+ */
+void animPlay(u8 anim, const AnimSeq* seq);
+
+/**
+ * @brief Jump to a frame of the current sequence (fires its event)
+ * @param anim Slot from animAdd()
+ * @param cursor Index into the sequence
+ */
+void animSeek(u8 anim, u8 cursor);
+
+/**
+ * @brief Advance every active slot by one update and dispatch frame events
+ */
+void animBatchUpdate();
+
+/**
+ * @brief Sprite frame currently shown by a slot
+ * @param anim Slot from animAdd()
+ */
+static inline u8 animFrame(u8 anim) {
+    return animSlots.seq[anim]->frames[animSlots.cursor[anim]].frame;
+}
+
+/**
+ * @brief Boxes of the frame currently shown by a slot
+ * @param anim Slot from animAdd()
+ * @return Box set, or NULL if the sequence has none
+ */
+static inline const FrameBoxes* animBoxes(u8 anim) {
+    const AnimSeq* seq = animSlots.seq[anim];
+    return seq->boxes ? &seq->boxes[animSlots.cursor[anim]] : NULL;
+}
+
+/**
+ * @brief Check whether a slot's frame changed in the last update
+ * @param anim Slot from animAdd()
+ */
+static inline bool animChanged(u8 anim) {
+    return animSlots.flags[anim] & ANIM_CHANGED;
+}
+
+/**
+ * @brief Check whether a non-looping sequence has reached its end
+ * @param anim Slot from animAdd()
+ */
+static inline bool animFinished(u8 anim) {
+    return animSlots.flags[anim] & ANIM_FINISHED;
+}
+
+#endif // ANIM_BATCH_H
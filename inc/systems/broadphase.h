@@ -0,0 +1,73 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include <genesis.h>
+#include "systems/collision.h"
+
+// Uniform-grid broadphase over CollisionBox.
+// Boxes are bucketed into a fixed 16x8 grid of 64px cells each frame. World
+// coordinates wrap onto the grid, so it works for any map size; the exact
+// AABB test filters out boxes that only share a wrapped cell.
+
+#define BROAD_MAX_BOXES 128
+#define BROAD_MAX_NODES 512     // Cell entries (a box covers 1-4 cells typically)
+#define BROAD_CELL_SHIFT 6      // 64px cells
+#define BROAD_GRID_W 16         // Cells across (power of two)
+#define BROAD_GRID_H 8          // Cells down (power of two)
+#define BROAD_NONE 0xFFFF
+
+/**
+ * @brief Called once per overlapping pair
+ * @param a Index of the first box (as returned by broadInsert)
+ * @param b Index of the second box
+ */
+typedef void BroadPairCallback(u16 a, u16 b);
+
+/**
+ * @brief Broadphase counters for the current frame
+ */
+typedef struct {
+    u16 boxes;          // Boxes inserted
+    u16 nodes;          // Cell entries used
+    u16 tests;          // Exact AABB tests run
+    u16 pairs;          // Overlapping pairs reported
+} BroadStats;
+
+extern BroadStats broadStats;
+
+/**
+ * @brief Empty the grid (call at the start of each frame's rebuild)
+ */
+void broadClear();
+
+/**
+ * @brief Add a box to the grid
+ * @param box Box in world pixels (copied)
+ * @return Box index, or BROAD_NONE if the grid is full
+ */
+u16 broadInsert(const CollisionBox* box);
+
+/**
+ * @brief Get a box previously inserted this frame
+ * @param index Box index from broadInsert()
+ * @return Pointer to the stored box
+ */
+const CollisionBox* broadGetBox(u16 index);
+
+/**
+ * @brief Find every inserted box overlapping a query box
+ * @param box Query box in world pixels
+ * @param out Receives box indices
+ * @param maxOut Capacity of out
+ * @return Number of indices written
+ */
+u16 broadQuery(const CollisionBox* box, u16* out, u16 maxOut);
+
+/**
+ * @brief Report each overlapping pair of inserted boxes exactly once
+ * @param callback Function called per pair
+ * @return Number of pairs reported
+ */
+u16 broadForEachPair(BroadPairCallback* callback);
+
+#endif // BROADPHASE_H
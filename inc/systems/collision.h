@@ -31,10 +31,12 @@ bool collisionAABB(CollisionBox* box1, CollisionBox* box2);
 bool collisionPointRect(s16 px, s16 py, CollisionBox* box);
 
 /**
- * @brief Check if player is on ground (simple Y threshold for now)
- * @param playerY Player's Y position
+ * @brief Check if an entity stands on ground in the zone's collision layer
+ * @param posX Entity X position
+ * @param posY Entity Y position
+ * @param box Hitbox relative to the position
  * @return TRUE if on ground, FALSE otherwise
  */
-bool checkGroundCollision(fix32 playerY);
+bool checkGroundCollision(fix32 posX, fix32 posY, const CollisionBox* box);
 
 #endif // COLLISION_H
@@ -0,0 +1,66 @@
+#ifndef DAMPING_H
+#define DAMPING_H
+
+#include <genesis.h>
+#include "core/config.h"
+
+// Division-free velocity damping.
+// Friction factors from config.h are turned into 1.15 fixed-point
+// coefficients at compile time, so damping a velocity is one 16x16 MULS
+// and a shift instead of a 32-bit multiply plus a libgcc divide.
+
+#define DAMPING_SHIFT 15
+
+/**
+ * @brief Convert a friction factor (0.0 - 1.0) to a 1.15 coefficient
+ *
+ * Folded by the compiler; takes the *_FACTOR constants rather than their
+ * fix32 forms, which only keep 10 fractional bits.
+ */
+#define DAMPING_COEF(factor) ((s16) ((factor) * (1 << DAMPING_SHIFT) + 0.5))
+
+#define DAMPING_GROUND DAMPING_COEF(GROUND_FRICTION_FACTOR)
+#define DAMPING_AIR DAMPING_COEF(AIR_FRICTION_FACTOR)
+
+// Velocities below this magnitude snap to zero (prevents infinite sliding)
+#define DAMPING_REST_THRESHOLD FIX32(0.1)
+
+_Static_assert(GROUND_FRICTION_FACTOR < 1.0 && AIR_FRICTION_FACTOR < 1.0,
+               "friction factors must be below 1.0 to fit a 1.15 coefficient");
+_Static_assert(FIX32_FRAC_BITS == 10,
+               "dampVelocity truncates to 16 bits, which only holds 32 px/frame with 22.10 fix32");
+
+/**
+ * @brief Scale a velocity by a damping coefficient
+ *
+ * The velocity must fit in 16 bits (under 32 px/frame), which holds for
+ * everything clamped by MAX_FALL_SPEED and the dash speed.
+ * Rounds toward zero like the integer division it replaces.
+ * @param vel Velocity to damp
+ * @param coef 1.15 coefficient from DAMPING_COEF()
+ * @return Damped velocity
+ */
+static inline fix32 dampVelocity(fix32 vel, s16 coef) {
+    s32 scaled = (s32) (s16) vel * coef;
+
+    if (scaled < 0) scaled += (1 << DAMPING_SHIFT) - 1;
+
+    return scaled >> DAMPING_SHIFT;
+}
+
+/**
+ * @brief Damp a velocity and snap it to zero once it's negligible
+ * @param vel Velocity to damp
+ * @param coef 1.15 coefficient from DAMPING_COEF()
+ * @return Damped velocity
+ */
+static inline fix32 dampToRest(fix32 vel, s16 coef) {
+    vel = dampVelocity(vel, coef);
+
+    if (vel < DAMPING_REST_THRESHOLD && vel > -DAMPING_REST_THRESHOLD) {
+        return FIX32(0);
+    }
+    return vel;
+}
+
+#endif // DAMPING_H
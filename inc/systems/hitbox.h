@@ -0,0 +1,73 @@
+#ifndef HITBOX_H
+#define HITBOX_H
+
+#include <genesis.h>
+#include "systems/animBatch.h"
+#include "systems/broadphase.h"
+
+// Hitbox/hurtbox resolution over the broadphase grid.
+// Each frame every actor submits the box set of the animation frame it is
+// showing. Resolving puts one team's hurtboxes in the grid at a time and
+// queries it with the other teams' active hitboxes, so a hitbox is only ever
+// tested against opposing hurtboxes sharing its cells: the cost follows the
+// hitboxes actually out and what is near them, not actors squared. A team
+// nobody is attacking costs nothing. All lists are capped.
+
+#define HITBOX_MAX_HURT 64          // Hurtboxes per frame; extras are dropped
+#define HITBOX_MAX_ACTIVE 32        // Hitboxes out at once; extras are dropped
+#define HITBOX_MAX_CANDIDATES 8     // Hurtboxes taken from one query
+#define HITBOX_MAX_HITS 16          // Attacker/victim pairs reported per frame
+
+/**
+ * @brief Called once per attacker/victim pair whose boxes overlap this frame
+ * @param attacker Id of the actor owning the hitbox
+ * @param victim Id of the actor owning the hurtbox
+ */
+typedef void HitHandler(u16 attacker, u16 victim);
+
+/**
+ * @brief Counters (per frame ones are for the last hitboxResolve())
+ */
+typedef struct {
+    u8 hurtboxes;
+    u8 hitboxes;
+    u16 tests;          // Exact box tests run by the grid queries
+    u8 hits;
+    u16 peakTests;
+    u32 testsTotal;
+    u32 hitsTotal;
+    u32 dropped;        // Boxes refused because a list or the grid was full
+} HitboxStats;
+
+extern HitboxStats hitboxStats;
+
+/**
+ * @brief Reset the counters
+ */
+void hitboxInit();
+
+/**
+ * @brief Start a frame: empty the hurtbox and hitbox lists
+ */
+void hitboxBegin();
+
+/**
+ * @brief Add an actor's boxes for this frame
+ * @param id Caller's actor id, passed to the hit handler
+ * @param team Actors on the same team never hit each other
+ * @param x Actor X in world pixels
+ * @param y Actor Y in world pixels
+ * @param width Actor collision width; left-facing boxes are mirrored across it
+ * @param facingRight Facing
+ * @param boxes Box set of the current frame (NULL: none)
+ */
+void hitboxSubmit(u16 id, u8 team, s16 x, s16 y, u8 width, bool facingRight, const FrameBoxes* boxes);
+
+/**
+ * @brief Test every active hitbox against the hurtboxes near it
+ * @param handler Called per hit pair (may despawn either actor)
+ * @return Number of pairs reported
+ */
+u8 hitboxResolve(HitHandler* handler);
+
+#endif // HITBOX_H
@@ -3,22 +3,158 @@
 
 #include <genesis.h>
 
+// Pad input for the game logic.
+// The pad is sampled once per frame by inputPoll(); everything else reads
+// that sample. One pad state per frame is therefore the whole input, so a
+// run can be recorded to a tape and replayed bit-exactly.
+//
+// Press/release edges are pushed, stamped with the frame they were sampled
+// on, into a single-producer/single-consumer ring. The game drains it in
+// inputUpdate() at a fixed point before the player and physics updates, so
+// actions never fire from inside SGDK's vblank joypad processing. Sampling
+// and draining both run in gameUpdate(), one after the other: the current
+// pad, previous pad and frame counter are plain statics shared by the two.
+//
+// Buffering: each binding maps buttons to an action with a window. A press
+// whose action can't happen yet (jump while airborne, attack during
+// recovery) is retried every frame until it succeeds or the window runs
+// out. The frames from the press to the action taking effect are counted
+// as its latency.
+//
+// Tape format: u16 words of run-length encoded JOY_1 states (stored
+// big-endian in files, so a tape can be linked into the ROM as-is).
+// A word holds the button mask in its low 12 bits and the run length
+// (1-15 frames) in its top 4; a length of 0 means the next word holds the
+// run length (1-65535). The pad rarely changes every frame, so a minute of
+// busy play is around a kilobyte. Replays start from the same game state as
+// the recording (same zone and abilities) to reproduce it.
+
+#define INPUT_PAD_MASK 0x0FFF       // Button bits (BUTTON_UP .. BUTTON_MODE)
+#define INPUT_RUN_SHIFT 12
+#define INPUT_RUN_SHORT 15          // Longest run stored in a single word
+
+#define INPUT_QUEUE_SIZE 16         // Pad edges in the ring (power of 2)
+#define INPUT_MAX_BINDINGS 8
+
+/**
+ * @brief A pad edge
+ */
+typedef struct {
+    u16 frame;          // inputPoll() frame count when sampled
+    u16 pressed;        // Buttons that went down
+    u16 released;       // Buttons that went up
+} InputEvent;
+
+/**
+ * @brief Action run for a press
+ * @return TRUE if it took effect (FALSE keeps the press buffered)
+ */
+typedef bool InputAction();
+
+/**
+ * @brief Buttons mapped to an action (ROM)
+ */
+typedef struct {
+    u16 buttons;        // Any of these pressed triggers it
+    u8 window;          // Frames a press is retried after the one it happened on
+    InputAction* action;
+} InputBinding;
+
+/**
+ * @brief Event queue and latency counters
+ */
+typedef struct {
+    u32 events;         // Edges queued
+    u32 overflows;      // Edges lost to a full ring
+    u32 actions;        // Presses that took effect
+    u32 buffered;       // ... of which after waiting at least one frame
+    u32 expired;        // Presses whose window ran out
+    u32 latencyTotal;   // Frames from press to effect, summed over actions
+    u16 latencyLast;
+    u16 latencyMax;
+} InputQueueStats;
+
+extern InputQueueStats inputQueueStats;
+
+typedef enum {
+    INPUT_LIVE,
+    INPUT_RECORD,
+    INPUT_REPLAY
+} InputMode;
+
+/**
+ * @brief Tape counters
+ */
+typedef struct {
+    u32 frames;         // Frames recorded or replayed
+    u32 runs;
+    u32 words;          // Tape words written or read
+    bool overflow;      // Recording stopped: tape buffer full
+    bool ended;         // Replay ran out of tape (input is idle since)
+} InputTapeStats;
+
+extern InputTapeStats inputTapeStats;
+
 /**
- * @brief Initialize input system and set up joystick event handler
+ * @brief Initialize the input system (live pad)
  */
 void inputInit();
 
 /**
- * @brief Read joystick state each frame for continuous input (D-pad)
+ * @brief Sample this frame's pad (live, or from the replay tape), record it
+ *        when recording and queue its edges (the ring's producer). Call once
+ *        per frame, in every game state.
+ */
+void inputPoll();
+
+/**
+ * @brief Pad state sampled by inputPoll() this frame
+ */
+u16 inputPad();
+
+/**
+ * @brief Drain the edge ring into the bindings, run due and buffered
+ *        actions, then the continuous input (D-pad). The ring's consumer.
  */
 void inputUpdate();
 
 /**
- * @brief Handle button press/release events
- * @param joy Joystick number (JOY_1, JOY_2)
- * @param changed Buttons that changed state
- * @param state Current state of buttons
+ * @brief Set the press bindings (replaces any previous set, drops buffered presses)
+ * @param bindings Binding table (ROM)
+ * @param count Entries, up to INPUT_MAX_BINDINGS
+ */
+void inputSetBindings(const InputBinding* bindings, u8 count);
+
+/**
+ * @brief Start recording the pad to a tape (live input keeps playing)
+ * @param buffer Tape words
+ * @param capacity Buffer size in words
+ */
+void inputRecord(u16* buffer, u32 capacity);
+
+/**
+ * @brief Stop recording and flush the last run
+ * @return Tape length in words
+ */
+u32 inputStopRecording();
+
+/**
+ * @brief Replay a tape instead of the live pad
+ * @param tape Tape words (ROM or RAM)
+ * @param length Tape length in words
+ */
+void inputReplay(const u16* tape, u32 length);
+
+/**
+ * @brief Current input mode
+ */
+InputMode inputMode();
+
+/**
+ * @brief Count the frames a tape covers
+ * @param tape Tape words
+ * @param length Tape length in words
  */
-void joyEventHandler(u16 joy, u16 changed, u16 state);
+u32 inputTapeFrames(const u16* tape, u32 length);
 
 #endif // INPUT_H
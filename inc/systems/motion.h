@@ -0,0 +1,37 @@
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <genesis.h>
+
+// Precomputed motion curves.
+// A curve is a ROM table of per-frame velocities (how far the actor moves
+// that frame), baked by tools/bakecurves from res/motion.curves. An actor
+// following a curve reads the entry for its frame counter instead of
+// running gravity or easing maths on its velocity, so jump arcs and dash
+// profiles are tuned in the spec without changing the per-frame cost.
+
+/**
+ * @brief Per-frame velocities (ROM)
+ */
+typedef struct {
+    const fix32* velocity;
+    u8 length;
+} MotionCurve;
+
+/**
+ * @brief Velocity for a frame of a curve (the last entry past the end)
+ */
+static inline fix32 motionVelocity(const MotionCurve* curve, u8 frame) {
+    return curve->velocity[frame < curve->length ? frame : curve->length - 1];
+}
+
+/**
+ * @brief First frame of a rising (increasing) curve at or above a velocity,
+ *        to switch curves mid-motion without a jump in speed
+ * @param curve Curve with increasing velocities
+ * @param velocity Current velocity
+ * @return Frame index, or the curve length if the curve never gets there
+ */
+u8 motionFind(const MotionCurve* curve, fix32 velocity);
+
+#endif // MOTION_H
@@ -0,0 +1,51 @@
+#ifndef PARALLAX_H
+#define PARALLAX_H
+
+#include <genesis.h>
+#include "systems/scroll.h"
+
+// Line-scroll parallax for the BG_B backdrop.
+// A zone's backdrop is split into horizontal bands, each following the
+// camera at its own speed. Band positions are kept as 8.8 accumulators and
+// stepped by repeated addition as the camera moves; the 224-entry hscroll
+// table is then just band values copied down the lines, and scroll.c sends
+// it with one DMA. Fixed cost per moving frame: bands x |dx| adds, 224
+// stores, one 896-byte upload. Zones without bands use plane scrolling.
+
+#define PARALLAX_MAX_BANDS 8
+#define PARALLAX_MAX_STEP 16            // Camera moves beyond this re-seed the bands
+
+// Single-slab backdrop for zones without bands
+#define PARALLAX_PLANE_FACTOR SCROLL_FACTOR(0.125)
+#define PARALLAX_DRIFT_X -1             // Pixels per frame
+
+/**
+ * @brief One horizontal strip of the backdrop
+ */
+typedef struct {
+    u8 lines;           // Height in scanlines
+    s16 factor;         // Speed relative to the camera (SCROLL_FACTOR)
+} ParallaxBand;
+
+/**
+ * @brief A zone's band layout (lines should add up to SCROLL_LINES)
+ */
+typedef struct {
+    u8 count;
+    const ParallaxBand* bands;
+} ParallaxSet;
+
+/**
+ * @brief Select the backdrop layout and the matching scroll mode
+ * @param set Band layout, or NULL for a single 1/8 speed slab
+ */
+void parallaxSetBands(const ParallaxSet* set);
+
+/**
+ * @brief Step band positions by the camera movement and rebuild the table
+ *
+ * Call once per frame before scrollUpdate().
+ */
+void parallaxUpdate();
+
+#endif // PARALLAX_H
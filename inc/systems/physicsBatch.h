@@ -0,0 +1,72 @@
+#ifndef PHYSICS_BATCH_H
+#define PHYSICS_BATCH_H
+
+#include <genesis.h>
+
+// Batched physics stage.
+// Every moving entity owns a body slot; positions, velocities and flags live
+// in parallel arrays so one tight loop per frame runs gravity, friction,
+// clamping and integration for all of them.
+
+#define PHYS_MAX_BODIES 32
+#define PHYS_BODY_NONE 0xFF
+
+// Body flags
+#define BODY_ACTIVE     0x01    // Slot in use
+#define BODY_GRAVITY    0x02    // Apply gravity this frame
+#define BODY_FRICTION   0x04    // Apply friction this frame
+#define BODY_INTEGRATE  0x08    // Move by velocity this frame
+#define BODY_ON_GROUND  0x10    // Use ground friction instead of air friction
+
+#define BODY_DYNAMIC (BODY_GRAVITY | BODY_FRICTION | BODY_INTEGRATE)
+
+typedef struct {
+    fix32 posX[PHYS_MAX_BODIES];
+    fix32 posY[PHYS_MAX_BODIES];
+    fix32 velX[PHYS_MAX_BODIES];
+    fix32 velY[PHYS_MAX_BODIES];
+    fix32 maxVelX[PHYS_MAX_BODIES];
+    fix32 maxVelY[PHYS_MAX_BODIES];
+    u8 flags[PHYS_MAX_BODIES];
+    u8 highWater;               // One past the highest slot ever used
+} PhysicsBodies;
+
+extern PhysicsBodies physBodies;
+
+/**
+ * @brief Clear all body slots
+ */
+void physicsBatchInit();
+
+/**
+ * @brief Claim a body slot
+ * @param posX Initial X position
+ * @param posY Initial Y position
+ * @param maxVelX Horizontal speed limit (clampVelocity)
+ * @param maxVelY Vertical speed limit (clampVelocity)
+ * @param flags BODY_* flags (BODY_ACTIVE is added automatically)
+ * @return Body index, or PHYS_BODY_NONE if all slots are taken
+ */
+u8 bodyAdd(fix32 posX, fix32 posY, fix32 maxVelX, fix32 maxVelY, u8 flags);
+
+/**
+ * @brief Release a body slot
+ * @param body Body index from bodyAdd()
+ */
+void bodyRemove(u8 body);
+
+/**
+ * @brief Replace the per-frame flags of a body (keeps it active)
+ * @param body Body index from bodyAdd()
+ * @param flags BODY_* flags
+ */
+static inline void bodySetFlags(u8 body, u8 flags) {
+    physBodies.flags[body] = flags | BODY_ACTIVE;
+}
+
+/**
+ * @brief Run gravity, friction, clamping and integration on every active body
+ */
+void physicsBatchUpdate();
+
+#endif // PHYSICS_BATCH_H
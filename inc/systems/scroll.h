@@ -0,0 +1,89 @@
+#ifndef SCROLL_H
+#define SCROLL_H
+
+#include <genesis.h>
+
+// Scroll manager.
+// Each plane is a layer that follows the camera by a parallax factor, plus
+// an optional constant drift. scrollUpdate() computes every plane offset
+// once per frame from currentCameraX/Y and queues one scroll table upload
+// per changed table (plane, tile-row or per-line mode).
+
+#define SCROLL_LINES 224        // Visible lines (V28)
+#define SCROLL_TILE_ROWS (SCROLL_LINES / 8)
+#define SCROLL_COLUMNS 20       // 16px VSRAM columns in H40
+
+// Parallax factor in 8.8 fixed point (1.0 = moves with the camera)
+#define SCROLL_FACTOR(f) ((s16) ((f) * 256))
+
+typedef enum {
+    SCROLL_LAYER_A,     // BG_A
+    SCROLL_LAYER_B,     // BG_B
+    SCROLL_LAYER_COUNT
+} ScrollLayer;
+
+/**
+ * @brief Reset layers (factor 1.0, no drift) and set plane scrolling mode
+ */
+void scrollInit();
+
+/**
+ * @brief Select the scroll table layout
+ * @param hMode HSCROLL_PLANE, HSCROLL_TILE or HSCROLL_LINE
+ * @param vMode VSCROLL_PLANE or VSCROLL_COLUMN
+ */
+void scrollSetMode(u16 hMode, u16 vMode);
+
+/**
+ * @brief Set how a layer follows the camera
+ * @param layer Layer to configure
+ * @param factorX Horizontal parallax factor (SCROLL_FACTOR)
+ * @param factorY Vertical parallax factor (SCROLL_FACTOR)
+ * @param driftX Pixels added to the horizontal offset every frame
+ * @param driftY Pixels added to the vertical offset every frame
+ */
+void scrollSetLayer(ScrollLayer layer, s16 factorX, s16 factorY, s16 driftX, s16 driftY);
+
+/**
+ * @brief Per-line (or per-tile-row) offsets added to a layer's H scroll
+ *
+ * Only used in HSCROLL_LINE / HSCROLL_TILE mode. The table must hold
+ * SCROLL_LINES (or SCROLL_TILE_ROWS) entries and stay valid; call
+ * scrollInvalidate() after changing its contents.
+ * @param layer Layer
+ * @param offsets Offset table, or NULL for none
+ */
+void scrollSetLineOffsets(ScrollLayer layer, const s16* offsets);
+
+/**
+ * @brief Per-column offsets added to a layer's V scroll (VSCROLL_COLUMN)
+ * @param layer Layer
+ * @param offsets SCROLL_COLUMNS entries, or NULL for none
+ */
+void scrollSetColumnOffsets(ScrollLayer layer, const s16* offsets);
+
+/**
+ * @brief Force the scroll tables to be rebuilt and sent next update
+ */
+void scrollInvalidate();
+
+/**
+ * @brief Compute all plane offsets for the current camera and queue uploads
+ *
+ * Call once per frame after the camera has moved.
+ */
+void scrollUpdate();
+
+/**
+ * @brief Current horizontal scroll value of a layer (before line offsets)
+ * @param layer Layer
+ */
+s16 scrollGetH(ScrollLayer layer);
+
+/**
+ * @brief Current vertical scroll value of a layer (before column offsets)
+ * @param layer Layer
+ */
+s16 scrollGetV(ScrollLayer layer);
+
+#endif // SCROLL_H
@@ -0,0 +1,106 @@
+#ifndef SPRITE_ANIM_H
+#define SPRITE_ANIM_H
+
+#include <genesis.h>
+#include "systems/animBatch.h"
+
+// Animation to sprite binding with a shared frame tile cache.
+// Bound sprites are created without SGDK's automatic tile upload; their
+// frame tiles live in the TILE_POOL_SPRITE VRAM pool instead. Tiles are
+// uploaded only when an animBatch slot's frame actually changes, and instances of
+// the same sprite definition showing the same frame share one copy in VRAM.
+// Frames nobody shows stay resident until their space is needed, so looping
+// animations stop uploading once every frame has been seen.
+
+#define SPRITE_ANIM_CACHE_SLOTS 8
+#define SPRITE_ANIM_NO_SLOT 0xFF
+
+// SPR_addSpriteEx() flags for bound sprites (VRAM and uploads are ours)
+#define SPRITE_ANIM_SPR_FLAGS (SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_SPRITE_ALLOC)
+
+/**
+ * @brief One animated sprite instance
+ */
+typedef struct {
+    Sprite* sprite;
+    u8 anim;            // animBatch slot driving the frames
+    u8 animation;       // Animation index in the sprite definition
+    u8 slot;            // Cache slot of the frame shown, SPRITE_ANIM_NO_SLOT if none
+} SpriteAnim;
+
+/**
+ * @brief Upload counters
+ */
+typedef struct {
+    // Last frame (rolled by spriteAnimEndFrame)
+    u8 frameUploads;
+    u16 frameTiles;
+
+    // Cumulative
+    u32 changes;        // Frame changes seen
+    u32 uploads;        // Frame changes that needed an upload
+    u32 uploadTiles;
+    u32 shared;         // Frame changes served from VRAM (shared or still resident)
+    u32 failed;         // No VRAM for a frame; the old frame stays up
+} SpriteAnimStats;
+
+extern SpriteAnimStats spriteAnimStats;
+
+/**
+ * @brief Drop every cached frame and reset the counters
+ *
+ * Call after tileAllocInit(); frees nothing, the pool is assumed fresh.
+ */
+void spriteAnimInit();
+
+/**
+ * @brief Add a sprite set up for manual tile management
+ * @param def Sprite definition (uncompressed tiles can be sent without unpacking)
+ * @param x Screen X
+ * @param y Screen Y
+ * @param attribut Tile attributes (palette, priority, flips)
+ * @return Sprite, or NULL if SGDK has none left
+ */
+Sprite* spriteAnimAddSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attribut);
+
+/**
+ * @brief Bind a sprite to a new animBatch slot and show its first frame
+ * @param binding Binding to set up
+ * @param sprite Sprite from spriteAnimAddSprite()
+ * @param animation Animation index in the sprite definition
+ * @param seq Frame sequence (frames index that animation)
+ * @param owner Owner id passed to frame event handlers
+ * @return FALSE if no animBatch slot is free
+ */
+bool spriteAnimBind(SpriteAnim* binding, Sprite* sprite, u8 animation, const AnimSeq* seq, u8 owner);
+
+/**
+ * @brief Switch the sequence of a bound sprite
+ *
+ * Nothing is uploaded unless the first frame differs from the one shown.
+ * @param binding Bound sprite
+ * @param animation Animation index in the sprite definition
+ * @param seq Frame sequence
+ */
+void spriteAnimPlay(SpriteAnim* binding, u8 animation, const AnimSeq* seq);
+
+/**
+ * @brief Point the sprite at its slot's current frame; uploads only on a change
+ *
+ * Call after animBatchUpdate() (and after any spriteAnimPlay()).
+ * @param binding Bound sprite
+ */
+void spriteAnimSync(SpriteAnim* binding);
+
+/**
+ * @brief Release the binding's frame and animBatch slot (the sprite is left alone)
+ * @param binding Bound sprite
+ */
+void spriteAnimUnbind(SpriteAnim* binding);
+
+/**
+ * @brief Close this frame's upload counters; call once per frame
+ */
+void spriteAnimEndFrame();
+
+#endif // SPRITE_ANIM_H
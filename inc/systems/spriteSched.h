@@ -0,0 +1,68 @@
+#ifndef SPRITE_SCHED_H
+#define SPRITE_SCHED_H
+
+#include <genesis.h>
+#include "core/config.h"
+
+// Sprite scheduler: scanline budget check and flicker rotation.
+// The VDP shows at most 20 hardware sprites (320 pixels) per scanline and 80
+// per frame in H40; anything later in the link list is silently dropped.
+// Drawn sprites are submitted each frame, bucketed into 8-line bands and
+// counted. When a band goes over the limit the link order of the
+// non-pinned sprites is rotated through SGDK depths, so the overflow moves
+// around from frame to frame and shows as flicker instead of the same
+// objects missing for good.
+
+#define SPR_SCHED_MAX 80                // Sprites submitted per frame
+#define SPR_SCHED_HW_MAX 80             // Hardware sprites per frame (H40)
+#define SPR_SCHED_LINE_MAX 20           // Hardware sprites per scanline (H40)
+#define SPR_SCHED_DOTS_MAX 320          // Sprite pixels per scanline (H40)
+#define SPR_SCHED_HW_WIDTH 32           // Widest hardware sprite in pixels
+#define SPR_SCHED_BAND_SHIFT 3          // 8-line bands
+#define SPR_SCHED_BANDS (SCREEN_HEIGHT >> SPR_SCHED_BAND_SHIFT)
+
+// SGDK depths (lower is earlier in the link list, drawn in front)
+#define SPR_SCHED_DEPTH_PINNED -0x100   // Pinned sprites (player) never rotate
+#define SPR_SCHED_DEPTH_BASE 0          // Rotated sprites take BASE + rank
+
+/**
+ * @brief Scheduler counters
+ */
+typedef struct {
+    // Last frame
+    u8 submitted;       // Sprites on screen
+    u8 hwSprites;       // Hardware sprites they need
+    u8 overBands;       // Bands over the line or pixel limit
+    u8 dropped;         // Sprites losing at least one band to the limits
+    u8 rotated;         // Depth changes made to rotate the link order
+
+    // Cumulative
+    u32 overflowFrames;
+    u32 droppedTotal;
+    u32 rotatedTotal;
+} SpriteSchedStats;
+
+extern SpriteSchedStats spriteSchedStats;
+
+/**
+ * @brief Reset the rotation and counters
+ */
+void spriteSchedInit();
+
+/**
+ * @brief Add a drawn sprite to this frame's schedule
+ * @param sprite Sprite (size is taken from its definition)
+ * @param x Screen X of the sprite
+ * @param y Screen Y of the sprite
+ * @param pinned Keep it first in the link order (never flickers)
+ */
+void spriteSchedSubmit(Sprite* sprite, s16 x, s16 y, bool pinned);
+
+/**
+ * @brief Count band usage, rotate the link order on overflow, clear the list
+ *
+ * Call once per frame after every sprite was submitted, before SPR_update().
+ */
+void spriteSchedUpdate();
+
+#endif // SPRITE_SCHED_H
@@ -0,0 +1,79 @@
+#ifndef STATE_MACHINE_H
+#define STATE_MACHINE_H
+
+#include <genesis.h>
+
+// Table-driven state machines.
+// An actor's states are described by a const table (ROM) indexed by the
+// state value: which states it may change to, owner-defined flags (input
+// locks, physics off, ...) and optional enter/update/exit handlers. The
+// actor only stores its current state byte, so any number of actors can
+// share a table. Whether a change is allowed is a single mask test.
+//
+// States that end on their own (a timer running out, an animation
+// finishing) usually allow few or no changes while they run and leave with
+// stateForce() from their own handlers.
+
+#define STATE_MAX 16                // States per table (allowed is a u16 mask)
+#define STATE_BIT(state) ((u16) 1 << (state))
+#define STATE_ALL 0xFFFF
+
+/**
+ * @brief State handler
+ * @param owner Actor given to the state call
+ */
+typedef void StateFunc(void* owner);
+
+/**
+ * @brief One state (ROM)
+ */
+typedef struct {
+    u16 allowed;            // STATE_BIT() of each state it may change to
+    u8 flags;               // Owner-defined
+    StateFunc* enter;       // After the state is set (also when re-entered)
+    StateFunc* update;      // From stateUpdate()
+    StateFunc* exit;        // Before the next state is set
+} StateDef;
+
+/**
+ * @brief Change state if the current state allows it (exit, then enter)
+ * @param table State table
+ * @param current Actor's state byte
+ * @param next State to change to
+ * @param owner Passed to the handlers
+ * @return TRUE if changed
+ */
+bool stateChange(const StateDef* table, u8* current, u8 next, void* owner);
+
+/**
+ * @brief Change state regardless of the allowed mask (a state ending itself)
+ * @param table State table
+ * @param current Actor's state byte
+ * @param next State to change to
+ * @param owner Passed to the handlers
+ */
+void stateForce(const StateDef* table, u8* current, u8 next, void* owner);
+
+/**
+ * @brief Run the current state's update handler, if any
+ * @param table State table
+ * @param current Actor's state
+ * @param owner Passed to the handler
+ */
+void stateUpdate(const StateDef* table, u8 current, void* owner);
+
+/**
+ * @brief Whether the current state allows changing to another
+ */
+static inline bool stateAllows(const StateDef* table, u8 current, u8 next) {
+    return (table[current].allowed & STATE_BIT(next)) != 0;
+}
+
+/**
+ * @brief Owner-defined flags of a state
+ */
+static inline u8 stateFlags(const StateDef* table, u8 current) {
+    return table[current].flags;
+}
+
+#endif // STATE_MACHINE_H
@@ -0,0 +1,78 @@
+#ifndef TILE_ALLOC_H
+#define TILE_ALLOC_H
+
+#include <genesis.h>
+
+// VRAM tile allocator.
+// The user tile area is split into fixed pools so long-lived and per-zone
+// data never fragment each other. Each pool keeps an address-ordered block
+// list; allocation is first fit, and freeing merges a block with free
+// neighbours so a zone can be swapped out and in again indefinitely.
+
+#define TILE_ALLOC_NONE 0xFFFF
+#define TILE_ALLOC_MAX_BLOCKS 24        // Blocks (used + free) per pool
+
+// Tiles at the top of the user area left to SGDK's sprite engine (SPR_init)
+#define TILE_POOL_SPR_ENGINE_SIZE 420
+
+// The HUD draws with SGDK's system font, which lives outside the user area
+#define TILE_POOL_SPRITE_SIZE 128
+// TILE_POOL_ZONE gets whatever is left
+
+typedef enum {
+    TILE_POOL_ZONE,     // Zone backgrounds and level tiles
+    TILE_POOL_SPRITE,   // Manually managed sprite frames
+    TILE_POOL_COUNT
+} TilePool;
+
+/**
+ * @brief Usage summary for one pool
+ */
+typedef struct {
+    u16 base;           // First VRAM tile of the pool
+    u16 size;           // Tiles in the pool
+    u16 used;           // Tiles allocated
+    u16 largestFree;    // Biggest single free block
+    u8 blocks;          // Blocks in the list (used + free)
+    u8 fragmentation;   // 0-100: share of free tiles outside the largest block
+} TileAllocStats;
+
+/**
+ * @brief Lay out the pools over the user tile area and free everything
+ */
+void tileAllocInit();
+
+/**
+ * @brief Allocate a run of tiles
+ * @param pool Pool to allocate from
+ * @param count Number of tiles
+ * @return First VRAM tile index, or TILE_ALLOC_NONE if no block fits
+ */
+u16 tileAlloc(TilePool pool, u16 count);
+
+/**
+ * @brief Return a run of tiles to its pool
+ * @param pool Pool it came from
+ * @param index First VRAM tile index from tileAlloc() (TILE_ALLOC_NONE is ignored)
+ */
+void tileFree(TilePool pool, u16 index);
+
+/**
+ * @brief Free every block of a pool at once
+ * @param pool Pool to clear
+ */
+void tileAllocReset(TilePool pool);
+
+/**
+ * @brief Get usage and fragmentation of a pool
+ * @param pool Pool to query
+ * @param stats Output summary
+ */
+void tileAllocGetStats(TilePool pool, TileAllocStats* stats);
+
+/**
+ * @brief Dump the usage of every pool to the debug log (KLog)
+ */
+void tileAllocDump();
+
+#endif // TILE_ALLOC_H
@@ -0,0 +1,134 @@
+#ifndef TILE_COLLISION_H
+#define TILE_COLLISION_H
+
+#include <genesis.h>
+#include "core/config.h"
+#include "systems/collision.h"
+
+// Tile collision layer.
+// Each zone has a ROM grid of 2-bit attributes, one per TILE_DIMENSION cell,
+// packed four cells per byte (cell 0 in the low bits). Rows are a power of
+// two bytes wide so a probe is shifts, one load and a mask - no scan.
+
+#define COLL_TILE_SHIFT 3       // log2(TILE_DIMENSION)
+
+// Cell attributes (bit 1 = supports standing, both bits = blocks sideways)
+#define COLL_EMPTY    0
+#define COLL_HAZARD   1
+#define COLL_PLATFORM 2         // One-way: only stops downward movement
+#define COLL_SOLID    3
+#define COLL_ATTR_MASK 3
+#define COLL_SUPPORTS 2
+
+_Static_assert((1 << COLL_TILE_SHIFT) == TILE_DIMENSION, "COLL_TILE_SHIFT must match TILE_DIMENSION");
+
+typedef struct {
+    u16 width;          // In tiles
+    u16 height;         // In tiles
+    u16 strideShift;    // log2(bytes per row)
+    const u8* cells;    // width/4 bytes per row, padded to 1 << strideShift
+} CollisionMap;
+
+// Collision layer of the current zone
+extern const CollisionMap* collisionMap;
+
+/**
+ * @brief Select the collision layer used by all lookups
+ * @param map Collision map in ROM
+ */
+void tileCollisionSetMap(const CollisionMap* map);
+
+/**
+ * @brief Attribute of the cell containing a pixel
+ *
+ * Above the map is open; left, right and below are solid.
+ * @param x Pixel X in world space
+ * @param y Pixel Y in world space
+ * @return COLL_* attribute
+ */
+static inline u16 tileAttrAt(s16 x, s16 y) {
+    const CollisionMap* map = collisionMap;
+
+    if (y < 0) return COLL_EMPTY;
+    if (x < 0) return COLL_SOLID;
+
+    u16 tx = (u16) x >> COLL_TILE_SHIFT;
+    u16 ty = (u16) y >> COLL_TILE_SHIFT;
+    if (tx >= map->width || ty >= map->height) return COLL_SOLID;
+
+    u8 cell = map->cells[(ty << map->strideShift) + (tx >> 2)];
+    return (cell >> ((tx & 3) << 1)) & COLL_ATTR_MASK;
+}
+
+/**
+ * @brief Check if the pixel is inside a solid cell
+ * @param x Pixel X in world space
+ * @param y Pixel Y in world space
+ * @return TRUE if solid, FALSE otherwise
+ */
+static inline bool tileSolidAt(s16 x, s16 y) {
+    return tileAttrAt(x, y) == COLL_SOLID;
+}
+
+/**
+ * @brief Check for standing support directly under a box
+ * @param x Box left in world pixels
+ * @param y Box top in world pixels
+ * @param w Box width
+ * @param h Box height
+ * @return TRUE if a solid or platform cell is under the box's feet
+ */
+static inline bool tileGroundUnder(s16 x, s16 y, u16 w, u16 h) {
+    s16 feet = y + h;
+    s16 right = x + w - 1;
+
+    // One probe per tile column the box covers (2-3 for a player)
+    for (s16 px = x; ; px += TILE_DIMENSION) {
+        if (px > right) px = right;
+        if (tileAttrAt(px, feet) & COLL_SUPPORTS) return TRUE;
+        if (px == right) return FALSE;
+    }
+}
+
+/**
+ * @brief Check for a solid cell in the column just ahead of a box
+ * @param x Box left in world pixels
+ * @param y Box top in world pixels
+ * @param w Box width
+ * @param h Box height
+ * @param facingRight Probe the right side if TRUE, the left side otherwise
+ * @return TRUE if a wall is ahead
+ */
+static inline bool tileWallAhead(s16 x, s16 y, u16 w, u16 h, bool facingRight) {
+    s16 column = facingRight ? x + w : x - 1;
+    s16 bottom = y + h - 1;
+
+    for (s16 py = y; ; py += TILE_DIMENSION) {
+        if (py > bottom) py = bottom;
+        if (tileSolidAt(column, py)) return TRUE;
+        if (py == bottom) return FALSE;
+    }
+}
+
+/**
+ * @brief Resolve horizontal movement against the collision layer
+ * @param posX Pointer to X position, snapped against a wall on contact
+ * @param posY Y position
+ * @param velX Pointer to horizontal velocity, zeroed on contact
+ * @param box Hitbox relative to the position
+ * @return TRUE if a wall was hit
+ */
+bool tileResolveX(fix32* posX, fix32 posY, fix32* velX, const CollisionBox* box);
+
+/**
+ * @brief Resolve vertical movement against the collision layer
+ * @param posY Pointer to Y position, snapped to floor/ceiling on contact
+ * @param prevPosY Y position before this frame's move (for one-way platforms)
+ * @param posX X position
+ * @param velY Pointer to vertical velocity, zeroed on contact
+ * @param box Hitbox relative to the position
+ * @return TRUE if landed on ground
+ */
+bool tileResolveY(fix32* posY, fix32 prevPosY, fix32 posX, fix32* velY, const CollisionBox* box);
+
+#endif // TILE_COLLISION_H
@@ -0,0 +1,86 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <genesis.h>
+
+// Hashed timer wheel for gameplay countdowns (dash, parry, stun, lifetimes).
+// A pending timer sits in the bucket of its due frame modulo the wheel size.
+// Each frame timerUpdate() walks only the bucket of the current frame and
+// fires the timers due on it; longer timers share the bucket and are skipped
+// until their round comes up. The per-frame cost follows the timers hashed
+// to one bucket, not every countdown in play.
+//
+// A timer either calls a function with a caller value or sets a flag.
+// Handles carry a generation like entity handles, so cancelling or querying
+// a timer that has already fired is harmless. The pool is static: sized for
+// the player's timers plus one per entity.
+
+#define TIMER_MAX 64
+#define TIMER_WHEEL_SLOTS 32        // Buckets (power of 2)
+#define TIMER_NONE 0                // Never a valid handle (generation 0 is skipped)
+#define TIMER_SLOT_NONE 0xFF
+
+typedef u16 TimerHandle;
+
+/**
+ * @brief Called when a timer fires (the timer is already free)
+ * @param arg Value given to timerStart()
+ */
+typedef void TimerCallback(u16 arg);
+
+/**
+ * @brief Pool and wheel counters
+ */
+typedef struct {
+    u8 active;
+    u8 peak;
+    u8 visited;             // Timers looked at by the last timerUpdate()
+    u32 visitedTotal;
+    u32 fired;
+    u32 cancelled;
+    u32 failed;             // Starts refused because the pool was full
+} TimerStats;
+
+extern TimerStats timerStats;
+
+/**
+ * @brief Drop every timer and reset the wheel
+ */
+void timerInit();
+
+/**
+ * @brief Call a function after a number of frames
+ * @param frames Fires on the frames-th timerUpdate() from now (0 counts as 1)
+ * @param callback Function to call
+ * @param arg Passed to the callback
+ * @return Handle, or TIMER_NONE if the pool is full
+ */
+TimerHandle timerStart(u16 frames, TimerCallback* callback, u16 arg);
+
+/**
+ * @brief Set a flag to TRUE after a number of frames
+ * @param frames Fires on the frames-th timerUpdate() from now (0 counts as 1)
+ * @param flag Flag to set (must outlive the timer)
+ * @return Handle, or TIMER_NONE if the pool is full
+ */
+TimerHandle timerStartFlag(u16 frames, bool* flag);
+
+/**
+ * @brief Stop a pending timer (fired, cancelled and TIMER_NONE handles are ignored)
+ * @param handle Handle from timerStart()/timerStartFlag()
+ */
+void timerCancel(TimerHandle handle);
+
+/**
+ * @brief Frames until a timer fires
+ * @param handle Handle from timerStart()/timerStartFlag()
+ * @return Remaining frames, 0 once it has fired or been cancelled
+ */
+u16 timerRemaining(TimerHandle handle);
+
+/**
+ * @brief Advance one frame and fire the timers due on it
+ */
+void timerUpdate();
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,100 @@
+#ifndef TRANSFER_H
+#define TRANSFER_H
+
+#include <genesis.h>
+
+// Central VRAM/CRAM/VSRAM transfer scheduler.
+// Systems enqueue transfers with a priority during the frame; transferFlush()
+// runs right before vblank and hands SGDK's DMA queue only what fits in the
+// vblank byte budget (after whatever SPR_update() already queued). Work that
+// doesn't fit carries over to the next frame instead of spilling into active
+// display.
+
+#define TRANSFER_MAX_ENTRIES 32
+#define TRANSFER_BUDGET_NTSC 7200   // Bytes per vblank, H40 NTSC
+#define TRANSFER_BUDGET_PAL 15000   // Bytes per vblank, H40 PAL
+
+typedef enum {
+    XFER_PRIO_CRITICAL,     // Sent this frame even over budget (scroll tables, map edges, sprite frames)
+    XFER_PRIO_HIGH,         // Palettes
+    XFER_PRIO_NORMAL,       // HUD
+    XFER_PRIO_LOW,          // Bulk loads (zone tiles)
+    XFER_PRIO_COUNT
+} TransferPriority;
+
+/**
+ * @brief Per-frame and cumulative scheduler figures
+ */
+typedef struct {
+    u16 lastBytes;      // Bytes handed to the DMA queue last flush (ours + SGDK's)
+    u16 peakBytes;      // Largest lastBytes seen
+    u16 pending;        // Entries still waiting after the last flush
+    u32 sentBytes;      // Total bytes sent through the scheduler
+    u32 carried;        // Entry-frames deferred to a later vblank
+    u32 overBudget;     // Flushes where critical work alone exceeded the budget
+} TransferStats;
+
+extern TransferStats transferStats;
+
+/**
+ * @brief Clear the queue and scroll shadows
+ */
+void transferInit();
+
+/**
+ * @brief Enqueue a transfer
+ *
+ * The source must stay valid until the transfer has been flushed, which
+ * can be a later frame for anything below XFER_PRIO_CRITICAL. Queued
+ * transfers with the same stride that this one overwrites are dropped or
+ * trimmed to the part it doesn't cover, so stale data never lands on top.
+ * @param location DMA_VRAM, DMA_CRAM or DMA_VSRAM
+ * @param from Source data
+ * @param to Destination address (bytes)
+ * @param len Length in words
+ * @param step Destination increment per word (2 for contiguous)
+ * @param priority Scheduling priority
+ * @return FALSE if the queue is full (critical transfers are sent directly)
+ */
+bool transferQueue(u8 location, const void* from, u16 to, u16 len, u16 step, TransferPriority priority);
+
+/**
+ * @brief Enqueue a run of tiles
+ * @param data Tile data
+ * @param index First VRAM tile
+ * @param num Number of tiles
+ * @param priority Scheduling priority
+ * @return FALSE if the queue is full
+ */
+bool transferTiles(const u32* data, u16 index, u16 num, TransferPriority priority);
+
+/**
+ * @brief Enqueue a 16-color palette (XFER_PRIO_HIGH)
+ * @param numPal PAL0-PAL3
+ * @param pal 16 colors
+ * @return FALSE if the queue is full
+ */
+bool transferPalette(u16 numPal, const u16* pal);
+
+/**
+ * @brief Drop every queued transfer of a priority
+ *
+ * For sources that are about to be freed before their transfers flush.
+ * @param priority Priority to drop
+ */
+void transferCancel(TransferPriority priority);
+
+/**
+ * @brief Number of transfers waiting at or above a priority
+ * @param priority Lowest priority to count
+ */
+u16 transferPending(TransferPriority priority);
+
+/**
+ * @brief Hand this frame's transfers to the DMA queue within budget
+ *
+ * Call once per frame after SPR_update() and before SYS_doVBlankProcess().
+ */
+void transferFlush();
+
+#endif // TRANSFER_H
@@ -9,15 +9,21 @@
 void hudInit();
 
 /**
- * @brief Update HUD display each frame
+ * @brief Compare HP/SP against what is on screen and mark changed digits
  */
 void hudUpdate();
 
 /**
- * @brief Render HUD to screen
+ * @brief Queue the changed digit tiles for the next vblank
  */
 void hudRender();
 
+/**
+ * @brief Draw the zone name (once per zone load)
+ * @param zoneID Zone to show
+ */
+void hudShowZone(u8 zoneID);
+
 /**
  * @brief Show/hide HUD
  * @param visible TRUE to show, FALSE to hide
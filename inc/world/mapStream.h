@@ -0,0 +1,81 @@
+#ifndef MAP_STREAM_H
+#define MAP_STREAM_H
+
+#include <genesis.h>
+
+// Incremental tilemap streaming.
+// The level map can be any size; only a 64x32 tile window of it lives in the
+// hardware plane. When the camera crosses a tile boundary, just the newly
+// exposed plane column(s)/row(s) are rebuilt and queued for DMA in vblank.
+
+#define STREAM_PLANE_W 64       // Hardware plane size in tiles
+#define STREAM_PLANE_H 32
+#define STREAM_MARGIN_X 11      // Tiles kept left of the view ((64 - 41) / 2)
+#define STREAM_MARGIN_Y 1       // Tiles kept above the view ((32 - 29) / 2)
+#define STREAM_MAX_COLUMNS 4    // Column uploads per frame before a full refresh (turn-around snaps 16px)
+#define STREAM_MAX_ROWS 2       // Row uploads per frame before a full refresh
+
+/**
+ * @brief Streaming counters (cumulative)
+ */
+typedef struct {
+    u32 columns;        // Plane columns uploaded
+    u32 rows;           // Plane rows uploaded
+    u32 refreshes;      // Full plane redraws
+} MapStreamStats;
+
+extern MapStreamStats mapStreamStats;
+
+/**
+ * @brief Attach a level map to a plane and draw the window at the camera
+ *
+ * The tilemap is read straight from ROM, so the IMAGE resource must use
+ * NONE compression. Its tileset must already be in VRAM.
+ * @param plane Plane to stream into
+ * @param level Level image resource
+ * @param baseAttr Palette/priority and VRAM tile index added to every cell
+ * @param cameraX Camera X in world pixels
+ * @param cameraY Camera Y in world pixels
+ */
+void mapStreamInit(VDPPlane plane, const Image* level, u16 baseAttr, s16 cameraX, s16 cameraY);
+
+/**
+ * @brief Attach a level map without drawing it yet
+ *
+ * Used by the zone loader to spread the initial draw over several frames.
+ * Streaming is held off until mapStreamDrawRows() has drawn every row.
+ * @param plane Plane to stream into
+ * @param level Level image resource
+ * @param baseAttr Palette/priority and VRAM tile index added to every cell
+ * @param cameraX Camera X in world pixels
+ * @param cameraY Camera Y in world pixels
+ */
+void mapStreamBegin(VDPPlane plane, const Image* level, u16 baseAttr, s16 cameraX, s16 cameraY);
+
+/**
+ * @brief Draw part of the window attached by mapStreamBegin()
+ * @param maxRows Maximum plane rows to draw now
+ * @return Rows still to draw
+ */
+u16 mapStreamDrawRows(u16 maxRows);
+
+/**
+ * @brief Follow the camera: queue exposed columns/rows
+ *
+ * The plane itself is scrolled by scroll.c (layer factor 1.0).
+ * @param cameraX Camera X in world pixels
+ * @param cameraY Camera Y in world pixels
+ */
+void mapStreamUpdate(s16 cameraX, s16 cameraY);
+
+/**
+ * @brief Level width in pixels
+ */
+u16 mapStreamWidth();
+
+/**
+ * @brief Level height in pixels
+ */
+u16 mapStreamHeight();
+
+#endif // MAP_STREAM_H
@@ -0,0 +1,82 @@
+#ifndef OBJECT_SPAWNER_H
+#define OBJECT_SPAWNER_H
+
+#include <genesis.h>
+#include "core/config.h"
+#include "entities/entity.h"
+
+// Camera-driven spawning from ROM object layouts.
+// A zone's objects are stored in ROM sorted by X. Two cursors bracket the
+// objects whose X lies in a window around the camera; as the camera scrolls
+// the cursors step over objects entering (spawned into the entity pool) and
+// leaving (released), so a frame costs only the objects crossing an edge.
+// Objects are released with a wider margin than they spawn with so a camera
+// hovering at an edge doesn't churn them. A per-zone bitset of collected or
+// defeated objects survives zone reloads and stops them from respawning.
+
+#define OBJ_MAX_PER_ZONE 128            // Bitset and handle table size (extra objects are ignored)
+#define OBJ_SPAWN_MARGIN 128            // Pixels past the view where objects spawn
+#define OBJ_RELEASE_MARGIN 192          // Pixels past the view where they are released
+#define OBJ_INDEX_NONE ENTITY_SLOT_NONE // Entity was not spawned from a layout
+
+/**
+ * @brief One placed object (ROM)
+ */
+typedef struct {
+    s16 x;
+    s16 y;
+    u8 type;            // EntityType
+    s8 param;           // Passed to entitySpawn()
+} ZoneObject;
+
+/**
+ * @brief A zone's objects, sorted by ascending X
+ */
+typedef struct {
+    u8 count;
+    const ZoneObject* objects;
+} ZoneObjectList;
+
+/**
+ * @brief Spawner counters (cumulative)
+ */
+typedef struct {
+    u32 spawns;
+    u32 releases;
+    u32 skipped;        // Objects not spawned because they were collected
+    u32 cursorSteps;    // Cursor moves, the per-frame cost driver
+} ObjectSpawnerStats;
+
+extern ObjectSpawnerStats objectSpawnerStats;
+
+/**
+ * @brief Clear every zone's collected bits (new game)
+ */
+void objectSpawnerInit();
+
+/**
+ * @brief Attach a zone's object layout; objects spawn on the next update
+ * @param zoneID Zone ID (selects the collected bitset)
+ * @param list Object layout, or NULL for none
+ */
+void objectSpawnerSetZone(u8 zoneID, const ZoneObjectList* list);
+
+/**
+ * @brief Move the cursors to the camera, spawning and releasing objects
+ * @param cameraX Camera X in pixels
+ */
+void objectSpawnerUpdate(s16 cameraX);
+
+/**
+ * @brief Mark an entity's layout object collected/defeated so it never respawns
+ * @param entity Entity spawned by this module (others are ignored)
+ */
+void objectSpawnerCollect(const Entity* entity);
+
+/**
+ * @brief Check whether an object of the current zone was collected
+ * @param index Index in the zone's layout
+ */
+bool objectSpawnerCollected(u8 index);
+
+#endif // OBJECT_SPAWNER_H
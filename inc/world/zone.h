@@ -3,6 +3,9 @@
 
 #include <genesis.h>
 #include "core/config.h"
+#include "systems/tileCollision.h"
+#include "systems/parallax.h"
+#include "world/objectSpawner.h"
 
 typedef struct {
     u8 zoneID;
@@ -21,10 +24,27 @@ void zoneInit();
 
 /**
  * @brief Load a specific zone
+ *
+ * Switches to GAME_STATE_TRANSITION; the level streams in over the
+ * following frames (see zoneLoader.h). The current zone, collision layer
+ * and objects stay on the old zone until the loader commits to the new one.
  * @param zoneID ID of the zone to load
  */
 void loadZone(u8 zoneID);
 
+/**
+ * @brief Make a zone current (collision, objects, HUD name)
+ *
+ * Called by the zone loader once the new level has its VRAM.
+ * @param zoneID ID of the zone being loaded
+ */
+void zoneCommit(u8 zoneID);
+
+/**
+ * @brief Keep the current zone after a load that could not start
+ */
+void zoneAbort();
+
 /**
  * @brief Unload current zone
  */
@@ -36,6 +56,34 @@ void unloadZone();
  */
 u8 getCurrentZone();
 
+/**
+ * @brief Get the ROM collision layer of a zone
+ * @param zoneID Zone ID
+ * @return Collision map
+ */
+const CollisionMap* getZoneCollisionMap(u8 zoneID);
+
+/**
+ * @brief Get the level image streamed into BG_A for a zone
+ * @param zoneID Zone ID
+ * @return Level image (uncompressed tilemap)
+ */
+const Image* getZoneLevelImage(u8 zoneID);
+
+/**
+ * @brief Get the backdrop band layout of a zone
+ * @param zoneID Zone ID
+ * @return Band layout, or NULL for plane scrolling
+ */
+const ParallaxSet* getZoneParallax(u8 zoneID);
+
+/**
+ * @brief Get the ROM object layout of a zone
+ * @param zoneID Zone ID
+ * @return Objects sorted by X
+ */
+const ZoneObjectList* getZoneObjects(u8 zoneID);
+
 /**
  * @brief Mark current zone as discovered
  */
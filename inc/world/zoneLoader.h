@@ -0,0 +1,66 @@
+#ifndef ZONE_LOADER_H
+#define ZONE_LOADER_H
+
+#include <genesis.h>
+
+// Frame-budgeted zone loader.
+// A zone load is split into steps (unpack tileset, upload tiles, draw the
+// level map, set palettes) that run a slice at a time while the screen is
+// faded out, so a transition never blocks the main loop for a whole load.
+
+#define ZONE_LOAD_DMA_BUDGET 4096       // VRAM bytes uploaded per frame
+#define ZONE_LOAD_ROWS_PER_FRAME 8      // Plane rows built per frame (CPU side)
+#define ZONE_LOAD_FADE_FRAMES 16        // Fade out / fade in length
+
+typedef enum {
+    ZONE_LOAD_IDLE,
+    ZONE_LOAD_FADE_OUT,
+    ZONE_LOAD_UNPACK,
+    ZONE_LOAD_TILES,
+    ZONE_LOAD_MAP,
+    ZONE_LOAD_PALETTE,
+    ZONE_LOAD_FADE_IN
+} ZoneLoadStep;
+
+/**
+ * @brief Figures for the last (or current) load
+ */
+typedef struct {
+    u16 frames;         // Frames from start to end of fade in
+    u16 workFrames;     // Frames spent on unpack/tiles/map/palette
+    u32 dmaBytes;       // Bytes sent to VRAM/CRAM
+    u16 maxFrameBytes;  // Largest single-frame upload
+} ZoneLoadStats;
+
+extern ZoneLoadStats zoneLoadStats;
+
+/**
+ * @brief Start loading a zone's level in the background
+ *
+ * Restarts cleanly if a load is already running.
+ * @param zoneID Zone to load
+ */
+void zoneLoaderStart(u8 zoneID);
+
+/**
+ * @brief Run one frame worth of loading
+ * @return TRUE while the load is still in progress
+ */
+bool zoneLoaderUpdate();
+
+/**
+ * @brief Check whether a load is in progress
+ */
+bool zoneLoaderBusy();
+
+/**
+ * @brief Current step of the load
+ */
+ZoneLoadStep zoneLoaderStep();
+
+/**
+ * @brief Load progress in percent (by bytes uploaded)
+ */
+u8 zoneLoaderProgress();
+
+#endif // ZONE_LOADER_H
@@ -1,5 +1,6 @@
 IMAGE background "background.png" BEST ALL
 IMAGE foreground "foreground.png" BEST ALL
+IMAGE hubLevel "hub.png" NONE ALL
 
-SPRITE pSprite "playerSprite.png" 6 6 FAST 0
+SPRITE pSprite "playerSprite.png" 6 6 NONE 0
 
@@ -1,16 +1,21 @@
 #include <genesis.h>
 #include <resources.h>
 #include "entities/player.h"
+#include "camera.h"
+#include "world/zone.h"
+#include "world/mapStream.h"
+#include "systems/tileAlloc.h"
+#include "systems/scroll.h"
+#include "systems/parallax.h"
+#include "systems/spriteAnim.h"
 
 void loadPlayerAssets();
 void loadLevelAssets();
-void updateBackgroundScroll();
 void initializeAssets();
 
 //Level Design Assets
-u16 ind = TILE_USER_INDEX;
-int scrollBackground_offset = 0;
-int scrollForeground_offset = 0;
+u16 backgroundTileIndex = TILE_ALLOC_NONE;
+u16 levelTileIndex = TILE_ALLOC_NONE;
 Sprite *playerSprite;
 
 
@@ -19,13 +24,13 @@ void initializeAssets()
     SPR_init();
     loadPlayerAssets();
     loadLevelAssets();
-    VDP_setScrollingMode(HSCROLL_PLANE, VSCROLL_PLANE);
 }
 
 void loadPlayerAssets()
 {
     PAL_setPalette(PAL2, pSprite.palette->data, DMA);
-    playerSprite = SPR_addSprite(
+    // Frame tiles are managed by the animation binding (systems/spriteAnim)
+    playerSprite = spriteAnimAddSprite(
                         &pSprite,
                         160,  // Just a reasonable default
                         180,  // playerInit() will override this anyway
@@ -35,6 +40,7 @@ void loadPlayerAssets()
 void loadLevelAssets()
 {
     // Background B - Use VDP_drawImageEx for Image resources
+    backgroundTileIndex = tileAlloc(TILE_POOL_ZONE, background.tileset->numTile);
     PAL_setPalette(PAL0, background.palette->data, DMA);
     VDP_drawImageEx(BG_B,
                     &background,
@@ -42,31 +48,26 @@ void loadLevelAssets()
                         FALSE,
                         FALSE,
                         FALSE,
-                        ind),
+                        backgroundTileIndex),
                     0, 0,
                     FALSE,
                     TRUE); // <- This extra argument is for a bitmap, not for a tilemap
-    ind += background.tileset->numTile;
-    
-    // Background A - Your original code was correct here
-    PAL_setPalette(PAL1, foreground.palette->data, DMA);
-    VDP_drawImageEx(BG_A,
-                    &foreground,
-                    TILE_ATTR_FULL(PAL1,
-                        FALSE,
-                        FALSE,
-                        FALSE,
-                        ind),
-                    0, 0,
-                    FALSE,
-                    TRUE);
-    ind +=foreground.tileset->numTile;
-}
 
-void updateBackgroundScroll()
-{
-    scrollBackground_offset -=1;
-    scrollForeground_offset -=2;
-    VDP_setHorizontalScroll(BG_A, scrollForeground_offset);
-    VDP_setHorizontalScroll(BG_B, scrollBackground_offset);
+    // Far layer: per-zone parallax bands, or one slab at 1/8 speed
+    parallaxSetBands(getZoneParallax(getCurrentZone()));
+    
+    // Background A - Zone level map, streamed around the camera
+    const Image* level = getZoneLevelImage(getCurrentZone());
+    levelTileIndex = tileAlloc(TILE_POOL_ZONE, level->tileset->numTile);
+    PAL_setPalette(PAL1, level->palette->data, DMA);
+    VDP_loadTileSet(level->tileset, levelTileIndex, DMA);
+    mapStreamInit(BG_A,
+                  level,
+                  TILE_ATTR_FULL(PAL1,
+                      FALSE,
+                      FALSE,
+                      FALSE,
+                      levelTileIndex),
+                  currentCameraX, currentCameraY);
+    scrollSetLayer(SCROLL_LAYER_A, SCROLL_FACTOR(1.0), SCROLL_FACTOR(1.0), 0, 0);
 }
\ No newline at end of file
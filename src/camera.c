@@ -1,6 +1,10 @@
 #include <genesis.h>
 #include <camera.h>
 #include "entities/player.h"
+#include "entities/entity.h"
+#include "world/mapStream.h"
+#include "world/objectSpawner.h"
+#include "systems/spriteSched.h"
 
 // These bounds are in screen coordinates relative to the center of the screen
 #define CAMERA_BOUNDS_LEFT 152
@@ -10,12 +14,9 @@
 //Viewport
 #define HORIZONTAL_RESOLUTION 320
 #define VERTICAL_RESOLUTION 224
-//MAP SIZE
-#define MAP_HEIGHT 100 // Placeholder
-#define MAP_WIDTH 100  // Placeholder
-//PLAYER SPRITE SIZE
-#define PLAYER_WIDTH 10  // Placeholder
-#define PLAYER_HEIGHT 10 // Placeholder
+//PLAYER SIZE
+#define PLAYER_WIDTH PLAYER_HITBOX_WIDTH
+#define PLAYER_HEIGHT PLAYER_HITBOX_HEIGHT
 
 // Global variables must have their type specified.
 u16 currentCameraX = 0;
@@ -24,20 +25,23 @@ u16 currentCameraY = 0;
 
 void mainCamera()
 {
+    // Map size comes from the zone's level map
+    s16 mapWidth = mapStreamWidth();
+    s16 mapHeight = mapStreamHeight();
 
-    // Stop player sprit leaving screen
+    // Stop player sprit leaving the map
     if (player.posX < FIX32(0))
         player.posX = FIX32(0);
-    else if (player.posX > FIX32(MAP_WIDTH) - PLAYER_WIDTH)
+    else if (player.posX > FIX32(mapWidth - PLAYER_WIDTH))
     {
-        player.posX = FIX32(MAP_WIDTH) - PLAYER_WIDTH;
+        player.posX = FIX32(mapWidth - PLAYER_WIDTH);
     }
 
     if (player.posY < FIX32(0))
         player.posY = FIX32(0);
-    else if (player.posY > FIX32(MAP_HEIGHT) - PLAYER_HEIGHT)
+    else if (player.posY > FIX32(mapHeight - PLAYER_HEIGHT))
     {
-        player.posY = FIX32(MAP_HEIGHT) - PLAYER_HEIGHT;
+        player.posY = FIX32(mapHeight - PLAYER_HEIGHT);
     }
 
     // Player position on the map
@@ -92,9 +96,9 @@ void mainCamera()
     {
         newCameraXPosition = 0;
     }
-    else if (newCameraXPosition > MAP_WIDTH - HORIZONTAL_RESOLUTION)
+    else if (newCameraXPosition > mapWidth - HORIZONTAL_RESOLUTION)
     {
-        newCameraXPosition = MAP_WIDTH - HORIZONTAL_RESOLUTION;
+        newCameraXPosition = max(mapWidth - HORIZONTAL_RESOLUTION, 0);
     }
 
     // Vertical
@@ -102,13 +106,10 @@ void mainCamera()
     {
         newCameraYPosition = 0;
     }
-    else if (newCameraYPosition > MAP_HEIGHT - VERTICAL_RESOLUTION)
+    else if (newCameraYPosition > mapHeight - VERTICAL_RESOLUTION)
     {
-        newCameraYPosition = MAP_HEIGHT - VERTICAL_RESOLUTION;
+        newCameraYPosition = max(mapHeight - VERTICAL_RESOLUTION, 0);
     }
-    u8 bHScroll;
-    u8 bVScroll;
-    u8 scrollSpeedModifier = 3;
     // Check if camera position changed
     if ((currentCameraX != newCameraXPosition) || (currentCameraY != newCameraYPosition))
     {
@@ -122,17 +123,25 @@ void mainCamera()
         // Apply smooth interpolation (divide by 4 for smooth follow)
         currentCameraX += diffX >> 2;
         currentCameraY += diffY >> 2;
+    }
+
+    // Level map: upload newly exposed columns/rows (scroll.c moves the planes)
+    mapStreamUpdate(currentCameraX, currentCameraY);
 
-        bHScroll = (0 - currentCameraX) >> scrollSpeedModifier;
-        bVScroll = currentCameraY;
+    // Zone objects entering/leaving the spawn window
+    objectSpawnerUpdate(currentCameraX);
+
+    // Player sprite position relative to the camera
+    if (player.sprite)
+    {
+        s16 x = F32_toInt(player.posX) - currentCameraX;
+        s16 y = F32_toInt(player.posY) - currentCameraY;
 
-        // bVScroll is u8, so it's always >= 0
-        if(bVScroll > 32) bVScroll = 0;
-        /*TO-DO MAP_scrollTo(,newCameraXPosition, newCameraYPosition) */
-        //Scrolling Background
-        VDP_setHorizontalScroll(BG_B,bHScroll);
-        VDP_setVerticalScroll(BG_B, bVScroll);
+        SPR_setPosition(player.sprite, x, y);
+        // Player stays first in the link order so it never flickers
+        spriteSchedSubmit(player.sprite, x, y, TRUE);
     }
 
-    // TO-DO Update player sprite position SPR_setPosition(playerSprite, F32_toInt(player.posX)-newCameraPositionX, F32_toInt(player.posY)-newCameraPositionY);
+    // Pooled entities follow the same camera
+    entityDrawAll();
 }
\ No newline at end of file
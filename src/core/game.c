@@ -3,10 +3,22 @@
 #include "core/config.h"
 #include "systems/input.h"
 #include "entities/player.h"
+#include "entities/entity.h"
 #include "assetLoader.h"
 #include "world/zone.h"
 #include "ui/hud.h"
 #include "gameplay/stats.h"
+#include "gameplay/combat.h"
+#include "core/profiler.h"
+#include "systems/physicsBatch.h"
+#include "systems/animBatch.h"
+#include "world/zoneLoader.h"
+#include "systems/tileAlloc.h"
+#include "systems/transfer.h"
+#include "systems/scroll.h"
+#include "systems/spriteSched.h"
+#include "systems/spriteAnim.h"
+#include "systems/timerWheel.h"
 
 // Global game state
 GameState currentGameState = GAME_STATE_TITLE;
@@ -14,6 +26,10 @@ GameState currentGameState = GAME_STATE_TITLE;
 void gameInit() {
     // Initialize SGDK systems
     SPR_init();
+    spriteSchedInit();
+    
+    // Initialize profiler (no-op unless PROFILE_ENABLED)
+    profInit();
     
     // Initialize input system
     inputInit();
@@ -21,14 +37,25 @@ void gameInit() {
     // Initialize zone system
     zoneInit();
     
+    // Initialize physics bodies, animation slots and timers (before anything claims a slot)
+    physicsBatchInit();
+    animBatchInit();
+    timerInit();
+    
     // Initialize stats
     statsInit();
     
-    // Initialize assets
+    // Initialize VRAM pools and transfer queue, then assets
+    tileAllocInit();
+    transferInit();
+    scrollInit();
+    spriteAnimInit();
     initializeAssets();
     
-    // Initialize player
+    // Initialize player and the entity pool
     playerInit();
+    entityPoolInit();
+    combatInit();
     
     // Initialize HUD
     hudInit();
@@ -38,27 +65,69 @@ void gameInit() {
 }
 
 void gameUpdate() {
+    // One pad sample per frame, whatever the state (keeps replays in step)
+    inputPoll();
+    
     switch (currentGameState) {
         case GAME_STATE_TITLE:
             // Title screen logic (to be implemented)
             // For now, just transition to playing on button press
-            if (JOY_readJoypad(JOY_1) & BUTTON_START) {
+            if (inputPad() & BUTTON_START) {
                 gameChangeState(GAME_STATE_PLAYING);
             }
             break;
             
         case GAME_STATE_PLAYING:
             // Main gameplay update
+            PROF_BEGIN(PROF_INPUT);
             inputUpdate();
+            PROF_END(PROF_INPUT);
+
+            // All animations in one pass (frame events fire here)
+            PROF_BEGIN(PROF_ANIM);
+            animBatchUpdate();
+            PROF_END(PROF_ANIM);
+
+            PROF_BEGIN(PROF_PLAYER);
             playerUpdate();
+            PROF_END(PROF_PLAYER);
+
+            // All moving bodies in one pass
+            PROF_BEGIN(PROF_PHYSICS);
+            physicsBatchUpdate();
+            PROF_END(PROF_PHYSICS);
+
+            PROF_BEGIN(PROF_PLAYER);
+            playerPostPhysics();
+            PROF_END(PROF_PLAYER);
+
+            // Countdowns due this frame (frozen while paused)
+            PROF_BEGIN(PROF_TIMERS);
+            timerUpdate();
+            PROF_END(PROF_TIMERS);
+
+            PROF_BEGIN(PROF_ENTITIES);
+            entityUpdateAll();
+            PROF_END(PROF_ENTITIES);
+            
+            // Hitboxes against hurtboxes, after everything has moved
+            PROF_BEGIN(PROF_COMBAT);
+            combatUpdate();
+            PROF_END(PROF_COMBAT);
+
+            PROF_BEGIN(PROF_HUD_UPDATE);
             hudUpdate();
+            PROF_END(PROF_HUD_UPDATE);
+
+            PROF_BEGIN(PROF_HUD_RENDER);
             hudRender();
+            PROF_END(PROF_HUD_RENDER);
             // Camera update will be called from main
             break;
             
         case GAME_STATE_PAUSED:
             // Pause menu logic
-            if (JOY_readJoypad(JOY_1) & BUTTON_START) {
+            if (inputPad() & BUTTON_START) {
                 gameChangeState(GAME_STATE_PLAYING);
             }
             break;
@@ -68,7 +137,10 @@ void gameUpdate() {
             break;
             
         case GAME_STATE_TRANSITION:
-            // Zone transition logic
+            // Zone load runs a budgeted slice per frame behind the fade
+            if (!zoneLoaderUpdate()) {
+                gameChangeState(GAME_STATE_PLAYING);
+            }
             break;
             
         default:
@@ -0,0 +1,222 @@
+#include <genesis.h>
+#include "core/profiler.h"
+
+#ifdef PROFILE_ENABLED
+
+// Scanlines per frame
+#define NTSC_LINES 262
+#define PAL_LINES 313
+
+// 68000 cycles per scanline (3420 master clocks / 7)
+#define CYCLES_PER_LINE 488
+
+// H40 counter runs 0x00-0xB6 then jumps to 0xE4-0xFF; V increments at 0xA5
+#define HCOUNTER_JUMP_FROM 0xB6
+#define HCOUNTER_JUMP_TO 0xE4
+#define HCOUNTER_LINE_START 0xA5
+
+static const char* sectionLabels[PROF_SECTION_COUNT] = {
+    "GAME", "CAM ", "SCRL", "SPR ", "XFER", "VBL ",
+    "INP ", "ANIM", "PLYR", "PHYS", "TIMR", "ENTS", "CMBT", "HUDU", "HUDR", "FRM "
+};
+
+static bool palSystem;
+static u16 frameLines;
+
+// Unwrapped position of the previous sample (line 0 = start of vblank)
+static u16 lastLine;
+
+static u32 frameStart;
+static u32 sectionStart[PROF_SECTION_COUNT];
+static u32 sectionTicks[PROF_SECTION_COUNT];
+
+static u16 history[PROF_SECTION_COUNT][PROF_HISTORY];
+static u16 historyHead;
+static u16 historyCount;
+
+static u16 barSection;
+
+/**
+ * Map a raw V counter value to a line number counted from the start of vblank.
+ * The V counter jumps back inside vblank (NTSC 0xEA->0xE5, PAL 0x02->0xCA),
+ * so some raw values stand for two lines; the one at or after the previous
+ * sample wins since samples are taken in order.
+ */
+static u16 unwrapLine(u8 v) {
+    u16 line;
+    u16 alt = 0xFFFF;
+
+    if (palSystem) {
+        if (v >= 0xE0) {
+            line = v - 0xE0;
+            alt = v - 0xCA + 35;
+        } else if (v <= 0x02) {
+            line = v + 32;
+            alt = v + 89;
+        } else if (v >= 0xCA) {
+            line = v - 0xCA + 35;
+            alt = v + 89;
+        } else {
+            line = v + 89;
+        }
+    } else {
+        if (v >= 0xE0 && v <= 0xEA) {
+            line = v - 0xE0;
+            if (v >= 0xE5) alt = v - 0xE5 + 11;
+        } else if (v > 0xEA) {
+            line = v - 0xE5 + 11;
+        } else {
+            line = v + 38;
+        }
+    }
+
+    if (line < lastLine) {
+        if (alt != 0xFFFF && alt >= lastLine) {
+            line = alt;
+        } else {
+            // Passed a whole vblank since the last sample (frame overrun)
+            line += frameLines;
+        }
+    }
+
+    lastLine = line;
+    return line;
+}
+
+static u32 sample() {
+    u16 hv = GET_HVCOUNTER;
+    u16 h = hv & 0xFF;
+    u16 line = unwrapLine(hv >> 8);
+
+    // Linearize H and rotate so tick 0 is where the V counter increments
+    if (h > HCOUNTER_JUMP_FROM) h -= HCOUNTER_JUMP_TO - HCOUNTER_JUMP_FROM - 1;
+    if (h >= HCOUNTER_LINE_START) h -= HCOUNTER_LINE_START;
+    else h += PROF_TICKS_PER_LINE - HCOUNTER_LINE_START;
+
+    return ((u32) line * PROF_TICKS_PER_LINE) + h;
+}
+
+void profInit() {
+    palSystem = SYS_isPAL();
+    frameLines = palSystem ? PAL_LINES : NTSC_LINES;
+
+    memset(history, 0, sizeof(history));
+    memset(sectionTicks, 0, sizeof(sectionTicks));
+    historyHead = 0;
+    historyCount = 0;
+    barSection = 0;
+    lastLine = 0;
+}
+
+void profFrameBegin() {
+    lastLine = 0;
+    frameStart = sample();
+    memset(sectionTicks, 0, sizeof(sectionTicks));
+}
+
+void profFrameEnd() {
+    sectionTicks[PROF_FRAME] = sample() - frameStart;
+
+    for (u16 s = 0; s < PROF_SECTION_COUNT; s++) {
+        u32 ticks = sectionTicks[s];
+        history[s][historyHead] = (ticks > 0xFFFF) ? 0xFFFF : ticks;
+    }
+
+    historyHead = (historyHead + 1) & (PROF_HISTORY - 1);
+    if (historyCount < PROF_HISTORY) historyCount++;
+}
+
+void profBegin(ProfSection section) {
+    sectionStart[section] = sample();
+}
+
+void profEnd(ProfSection section) {
+    sectionTicks[section] += sample() - sectionStart[section];
+}
+
+void profGetStats(ProfSection section, ProfStats* stats) {
+    const u16* ring = history[section];
+    u32 sum = 0;
+
+    stats->min = 0xFFFF;
+    stats->max = 0;
+    stats->last = ring[(historyHead - 1) & (PROF_HISTORY - 1)];
+
+    if (historyCount == 0) {
+        stats->min = 0;
+        stats->avg = 0;
+        return;
+    }
+
+    for (u16 i = 0; i < historyCount; i++) {
+        u16 ticks = ring[i];
+        if (ticks < stats->min) stats->min = ticks;
+        if (ticks > stats->max) stats->max = ticks;
+        sum += ticks;
+    }
+
+    stats->avg = sum / historyCount;
+}
+
+void profDrawBars() {
+    // Label + ':' + bar, wide enough for a full PAL frame
+    char row[40];
+    ProfStats stats;
+    u16 budgetCol;
+    u16 len;
+
+    profGetStats(barSection, &stats);
+
+    memcpy(row, sectionLabels[barSection], 4);
+    row[4] = ':';
+
+    // One bar character per PROF_LINES_PER_CHAR lines, '|' marks the frame budget
+    len = stats.last / (PROF_TICKS_PER_LINE * PROF_LINES_PER_CHAR);
+    budgetCol = frameLines / PROF_LINES_PER_CHAR;
+    if (budgetCol > 33) budgetCol = 33;
+    if (len > 33) len = 33;
+
+    for (u16 i = 0; i < 33; i++) {
+        if (i < len) row[5 + i] = (i < budgetCol) ? '=' : '#';
+        else if (i == budgetCol) row[5 + i] = '|';
+        else row[5 + i] = ' ';
+    }
+    row[38] = 0;
+
+    VDP_drawText(row, 1, PROF_BAR_ROW + barSection);
+
+    if (++barSection >= PROF_SECTION_COUNT) barSection = 0;
+}
+
+void profDump() {
+    ProfStats stats;
+
+    kprintf("profile: %u frames, %u lines/frame", historyCount, frameLines);
+
+    for (u16 s = 0; s < PROF_SECTION_COUNT; s++) {
+        profGetStats(s, &stats);
+        kprintf("%s min %5u avg %5u max %5u ticks (avg %lu cycles)",
+                sectionLabels[s], stats.min, stats.avg, stats.max,
+                ((u32) stats.avg * CYCLES_PER_LINE) / PROF_TICKS_PER_LINE);
+    }
+}
+
+#else
+
+// Profiler compiled out: keep the API linkable so callers need no #ifdefs
+
+void profInit() {}
+void profFrameBegin() {}
+void profFrameEnd() {}
+void profBegin(ProfSection section) { (void) section; }
+void profEnd(ProfSection section) { (void) section; }
+
+void profGetStats(ProfSection section, ProfStats* stats) {
+    (void) section;
+    memset(stats, 0, sizeof(ProfStats));
+}
+
+void profDrawBars() {}
+void profDump() {}
+
+#endif // PROFILE_ENABLED
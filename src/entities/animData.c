@@ -0,0 +1,45 @@
+// Generated by tools/bakeboxes from res/anims.boxes - do not edit
+
+#include <genesis.h>
+#include "entities/animData.h"
+
+static const FrameBox boxes0[] = { { 0, 0, 16, 44 } };
+static const FrameBox boxes2[] = { { 0, 0, 16, 44 }, { 12, 20, 22, 18 } };
+static const FrameBox boxes3[] = { { 0, 0, 16, 44 }, { 12, 14, 30, 28 } };
+static const FrameBox boxes5[] = { { 0, 0, 16, 44 }, { 14, 4, 8, 28 } };
+static const FrameBox boxes6[] = { { 0, 0, 16, 16 }, { 2, 2, 12, 12 } };
+static const FrameBox boxes7[] = { { 0, 0, 8, 4 } };
+
+static const AnimSeqFrame playerIdleSeqFrames[] = {
+    { 0, ANIM_HOLD, ANIM_EVENT_NONE, 0 },
+};
+static const FrameBoxes playerIdleSeqBoxes[] = {
+    { boxes0, 1, 0 },
+};
+const AnimSeq playerIdleSeq = { playerIdleSeqFrames, 1, TRUE, playerIdleSeqBoxes };
+
+static const AnimSeqFrame playerAttackSeqFrames[] = {
+    { 0, 4, ANIM_EVENT_NONE, 0 },
+    { 0, 3, ANIM_EVENT_HITBOX_ON, 0 },
+    { 0, 5, ANIM_EVENT_NONE, 0 },
+    { 0, 8, ANIM_EVENT_HITBOX_OFF, 0 },
+};
+static const FrameBoxes playerAttackSeqBoxes[] = {
+    { boxes0, 1, 0 },
+    { boxes2, 1, 1 },
+    { boxes3, 1, 1 },
+    { boxes0, 1, 0 },
+};
+const AnimSeq playerAttackSeq = { playerAttackSeqFrames, 4, FALSE, playerAttackSeqBoxes };
+
+static const AnimSeqFrame playerParrySeqFrames[] = {
+    { 0, ANIM_HOLD, ANIM_EVENT_NONE, 0 },
+};
+static const FrameBoxes playerParrySeqBoxes[] = {
+    { boxes5, 2, 0 },
+};
+const AnimSeq playerParrySeq = { playerParrySeqFrames, 1, FALSE, playerParrySeqBoxes };
+
+const FrameBoxes enemyBoxes = { boxes6, 1, 1 };
+
+const FrameBoxes projectileBoxes = { boxes7, 0, 1 };
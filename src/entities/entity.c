@@ -0,0 +1,222 @@
+#include <genesis.h>
+#include "entities/entity.h"
+#include "core/config.h"
+#include "camera.h"
+#include "systems/hitbox.h"
+
+EntityPoolStats entityStats;
+
+static Entity entities[ENTITY_MAX];
+static u8 freeHead;
+
+// One past the highest slot ever used; update loops stop here
+static u8 highWater;
+
+// Frame counter for the staggered margin and dormant ticks
+static u8 tick;
+
+void entityPoolInit() {
+    memset(entities, 0, sizeof(entities));
+    memset(&entityStats, 0, sizeof(entityStats));
+
+    for (u8 i = 0; i < ENTITY_MAX; i++) {
+        entities[i].nextFree = (i + 1 < ENTITY_MAX) ? i + 1 : ENTITY_SLOT_NONE;
+    }
+    freeHead = 0;
+    highWater = 0;
+    tick = 0;
+}
+
+EntityHandle entitySpawn(EntityType type, fix32 posX, fix32 posY, s16 param) {
+    if (freeHead == ENTITY_SLOT_NONE || type == ENTITY_TYPE_NONE) {
+        entityStats.failed++;
+        return ENTITY_NONE;
+    }
+
+    u8 index = freeHead;
+    Entity* e = &entities[index];
+
+    freeHead = e->nextFree;
+
+    // Generation 0 is reserved so ENTITY_NONE can never match a live slot
+    u8 generation = e->generation + 1;
+    if (!generation) generation = 1;
+
+    memset(e, 0, sizeof(Entity));
+    e->posX = posX;
+    e->posY = posY;
+    e->type = type;
+    e->generation = generation;
+    e->nextFree = ENTITY_SLOT_NONE;
+    e->layoutIndex = ENTITY_SLOT_NONE;
+    e->facingRight = TRUE;
+    e->param = param;
+    e->activity = ENTITY_IN_VIEW;   // Re-classed on the next update pass
+
+    if (entityTypes[type].spawn) entityTypes[type].spawn(e);
+
+    if (index >= highWater) highWater = index + 1;
+    entityStats.spawns++;
+    if (++entityStats.active > entityStats.peak) entityStats.peak = entityStats.active;
+
+    return ENTITY_HANDLE(index, generation);
+}
+
+void entityDespawn(EntityHandle handle) {
+    Entity* e = entityGet(handle);
+    if (!e) return;
+
+    u8 index = ENTITY_HANDLE_INDEX(handle);
+
+    if (e->sprite) {
+        SPR_releaseSprite(e->sprite);
+        e->sprite = NULL;
+    }
+
+    timerCancel(e->timer);
+    e->timer = TIMER_NONE;
+
+    // Keep the generation so old handles stay stale
+    e->type = ENTITY_TYPE_NONE;
+    e->nextFree = freeHead;
+    freeHead = index;
+
+    entityStats.despawns++;
+    entityStats.active--;
+
+    // Shrink the scan range when the top slots empty out
+    while (highWater && entities[highWater - 1].type == ENTITY_TYPE_NONE) highWater--;
+}
+
+void entityDespawnAll() {
+    for (u8 i = highWater; i; i--) {
+        Entity* e = &entities[i - 1];
+
+        if (e->type != ENTITY_TYPE_NONE) entityDespawn(ENTITY_HANDLE(i - 1, e->generation));
+    }
+}
+
+Entity* entityGet(EntityHandle handle) {
+    u8 index = ENTITY_HANDLE_INDEX(handle);
+
+    if (index >= ENTITY_MAX) return NULL;
+
+    Entity* e = &entities[index];
+    if (e->type == ENTITY_TYPE_NONE || e->generation != ENTITY_HANDLE_GENERATION(handle)) {
+        if (handle != ENTITY_NONE) entityStats.staleLookups++;
+        return NULL;
+    }
+    return e;
+}
+
+EntityHandle entityHandleOf(const Entity* entity) {
+    u8 index = entity - entities;
+    return ENTITY_HANDLE(index, entity->generation);
+}
+
+/**
+ * Class a position against the camera. Offsets are biased so each range
+ * check is a single unsigned compare.
+ */
+static EntityActivity classify(const Entity* e, s16 cameraX, s16 cameraY) {
+    u16 dx = F32_toInt(e->posX) - cameraX + ENTITY_VIEW_SLACK;
+    u16 dy = F32_toInt(e->posY) - cameraY + ENTITY_VIEW_SLACK;
+
+    if (dx < SCREEN_WIDTH + ENTITY_VIEW_SLACK && dy < SCREEN_HEIGHT + ENTITY_VIEW_SLACK) return ENTITY_IN_VIEW;
+
+    dx += ENTITY_MARGIN;
+    dy += ENTITY_MARGIN;
+    if (dx < SCREEN_WIDTH + ENTITY_VIEW_SLACK + (ENTITY_MARGIN * 2) &&
+        dy < SCREEN_HEIGHT + ENTITY_VIEW_SLACK + (ENTITY_MARGIN * 2)) return ENTITY_IN_MARGIN;
+
+    return ENTITY_DORMANT;
+}
+
+static void setActivity(Entity* e, EntityActivity activity) {
+    // Dormancy freezes the entity; don't make it catch up on waking
+    if (e->activity == ENTITY_DORMANT) e->elapsed = 0;
+
+    if (e->sprite && ((activity == ENTITY_IN_VIEW) != (e->activity == ENTITY_IN_VIEW))) {
+        SPR_setVisibility(e->sprite, activity == ENTITY_IN_VIEW ? VISIBLE : HIDDEN);
+    }
+    e->activity = activity;
+}
+
+bool entitySetState(Entity* e, u8 state) {
+    const StateDef* states = entityTypes[e->type].states;
+
+    return states && stateChange(states, &e->state, state, e);
+}
+
+void entityUpdateAll() {
+    s16 cameraX = currentCameraX;
+    s16 cameraY = currentCameraY;
+    u8 inView = 0;
+    u8 inMargin = 0;
+    u8 dormant = 0;
+    u8 updates = 0;
+
+    tick++;
+
+    for (u8 i = 0; i < highWater; i++) {
+        Entity* e = &entities[i];
+
+        if (e->type == ENTITY_TYPE_NONE) continue;
+
+        // Slots are staggered so the reduced-rate work spreads over frames
+        u8 phase = tick + i;
+
+        if (e->activity == ENTITY_DORMANT && (phase & (ENTITY_DORMANT_RECHECK - 1))) {
+            dormant++;
+            continue;
+        }
+
+        EntityActivity activity = classify(e, cameraX, cameraY);
+        if (activity != e->activity) setActivity(e, activity);
+
+        if (activity == ENTITY_DORMANT) {
+            dormant++;
+            continue;
+        }
+
+        e->elapsed++;
+        if (activity == ENTITY_IN_MARGIN) {
+            inMargin++;
+            if (phase & (ENTITY_MARGIN_TICK - 1)) continue;
+        } else {
+            inView++;
+        }
+
+        // Update may despawn this entity or spawn into a lower slot
+        entityTypes[e->type].update(e);
+        e->elapsed = 0;
+        updates++;
+    }
+
+    entityStats.inView = inView;
+    entityStats.inMargin = inMargin;
+    entityStats.dormant = dormant;
+    entityStats.updates = updates;
+}
+
+void entityDrawAll() {
+    for (u8 i = 0; i < highWater; i++) {
+        Entity* e = &entities[i];
+
+        if (e->type != ENTITY_TYPE_NONE && e->activity == ENTITY_IN_VIEW) entityTypes[e->type].draw(e);
+    }
+}
+
+void entitySubmitHitboxes(u8 team) {
+    for (u8 i = 0; i < highWater; i++) {
+        Entity* e = &entities[i];
+
+        if (e->type == ENTITY_TYPE_NONE || e->activity != ENTITY_IN_VIEW) continue;
+
+        const FrameBoxes* boxes = entityTypes[e->type].boxes;
+        if (boxes) {
+            hitboxSubmit(ENTITY_HANDLE(i, e->generation), team, F32_toInt(e->posX), F32_toInt(e->posY),
+                         entityTypes[e->type].width, e->facingRight, boxes);
+        }
+    }
+}
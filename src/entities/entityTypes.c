@@ -0,0 +1,140 @@
+#include <genesis.h>
+#include "entities/entity.h"
+#include "entities/player.h"
+#include "entities/animData.h"
+#include "systems/collision.h"
+#include "systems/tileCollision.h"
+#include "camera.h"
+#include "systems/spriteSched.h"
+#include "world/objectSpawner.h"
+
+#define ENEMY_WIDTH 16
+#define ENEMY_HEIGHT 16
+#define PICKUP_WIDTH 8
+#define PICKUP_HEIGHT 8
+#define PROJECTILE_WIDTH 8
+#define PROJECTILE_HEIGHT 4
+#define PROJECTILE_LIFETIME 90      // Frames before a shot expires on its own
+#define ENEMY_RECOIL_TIME 24        // Frames a parried enemy backs off
+#define ENEMY_RECOIL_SPEED 2        // Walk speed multiplier while backing off
+
+// Enemy: walks at param px/frame, turns at walls and ledges
+// (margin ticks cover several frames, stepped one at a time so no
+// ledge or wall is skipped).
+// A parry sends it into recoil: it backs away from the player at
+// ENEMY_RECOIL_SPEED times its speed until a timer brings it back.
+
+static void enemySpawn(Entity* e) {
+    e->velX = FIX32(e->param);
+    e->facingRight = e->param >= 0;
+}
+
+static void enemyWalk(void* owner) {
+    Entity* e = owner;
+    s16 y = F32_toInt(e->posY);
+
+    for (u8 frame = 0; frame < e->elapsed; frame++) {
+        s16 x = F32_toInt(e->posX);
+
+        bool ledge = !tileSolidAt(e->facingRight ? x + ENEMY_WIDTH : x - 1, y + ENEMY_HEIGHT);
+        if (ledge || tileWallAhead(x, y, ENEMY_WIDTH, ENEMY_HEIGHT, e->facingRight)) {
+            e->facingRight = !e->facingRight;
+            e->velX = -e->velX;
+        }
+
+        e->posX += e->velX;
+    }
+}
+
+static void enemyRecover(u16 handle) {
+    Entity* e = entityGet(handle);
+
+    if (!e) return;
+    e->timer = TIMER_NONE;
+    stateForce(entityTypes[e->type].states, &e->state, ENEMY_STATE_WALK, e);
+}
+
+static void enemyRecoilEnter(void* owner) {
+    Entity* e = owner;
+    s16 speed = abs(e->param) * ENEMY_RECOIL_SPEED;
+
+    e->facingRight = F32_toInt(e->posX) >= F32_toInt(player.posX);
+    e->velX = FIX32(e->facingRight ? speed : -speed);
+    e->timer = timerStart(ENEMY_RECOIL_TIME, enemyRecover, entityHandleOf(e));
+}
+
+static void enemyRecoilExit(void* owner) {
+    Entity* e = owner;
+    s16 speed = abs(e->param);
+
+    e->velX = FIX32(e->facingRight ? speed : -speed);
+}
+
+static const StateDef enemyStates[ENEMY_STATE_COUNT] = {
+    //                         allowed                         flags  enter             update     exit
+    [ENEMY_STATE_WALK]   = { STATE_BIT(ENEMY_STATE_RECOIL),  0,     NULL,             enemyWalk, NULL },
+    [ENEMY_STATE_RECOIL] = { 0,                              0,     enemyRecoilEnter, enemyWalk, enemyRecoilExit },
+};
+
+static void enemyUpdate(Entity* e) {
+    stateUpdate(enemyStates, e->state, e);
+}
+
+// Pickup: collected when the player overlaps it
+
+static void pickupUpdate(Entity* e) {
+    CollisionBox self = { F32_toInt(e->posX), F32_toInt(e->posY), PICKUP_WIDTH, PICKUP_HEIGHT };
+    CollisionBox hero = { F32_toInt(player.posX), F32_toInt(player.posY), PLAYER_HITBOX_WIDTH, PLAYER_HITBOX_HEIGHT };
+
+    if (collisionAABB(&self, &hero)) {
+        objectSpawnerCollect(e);
+        entityDespawn(entityHandleOf(e));
+    }
+}
+
+// Projectile: flies at param px/frame until it hits a wall or expires
+// (the lifetime runs on the timer wheel, dormant or not). Margin ticks
+// test every frame's position so thin walls still stop it.
+
+static void projectileExpire(u16 handle) {
+    entityDespawn(handle);
+}
+
+static void projectileSpawn(Entity* e) {
+    e->velX = FIX32(e->param);
+    e->facingRight = e->param >= 0;
+    e->timer = timerStart(PROJECTILE_LIFETIME, projectileExpire, entityHandleOf(e));
+}
+
+static void projectileUpdate(Entity* e) {
+    s16 y = F32_toInt(e->posY);
+
+    for (u8 frame = 0; frame < e->elapsed; frame++) {
+        e->posX += e->velX;
+
+        s16 x = F32_toInt(e->posX);
+        if (tileSolidAt(e->facingRight ? x + PROJECTILE_WIDTH - 1 : x, y)) {
+            entityDespawn(entityHandleOf(e));
+            return;
+        }
+    }
+}
+
+// Shared: place the sprite relative to the camera
+
+static void spriteDraw(Entity* e) {
+    if (!e->sprite) return;
+
+    s16 x = F32_toInt(e->posX) - currentCameraX;
+    s16 y = F32_toInt(e->posY) - currentCameraY;
+
+    SPR_setPosition(e->sprite, x, y);
+    spriteSchedSubmit(e->sprite, x, y, FALSE);
+}
+
+const EntityTypeInfo entityTypes[ENTITY_TYPE_COUNT] = {
+    [ENTITY_TYPE_NONE]       = { NULL, NULL, NULL, NULL, 0, NULL },
+    [ENTITY_TYPE_ENEMY]      = { enemySpawn, enemyUpdate, spriteDraw, &enemyBoxes, ENEMY_WIDTH, enemyStates },
+    [ENTITY_TYPE_PICKUP]     = { NULL, pickupUpdate, spriteDraw, NULL, PICKUP_WIDTH, NULL },
+    [ENTITY_TYPE_PROJECTILE] = { projectileSpawn, projectileUpdate, spriteDraw, &projectileBoxes, PROJECTILE_WIDTH, NULL },
+};
@@ -0,0 +1,30 @@
+// Generated by tools/bakecurves from res/motion.curves - do not edit
+
+#include <genesis.h>
+#include "entities/motionData.h"
+
+// 15 frames, rises 60.0 px
+static const fix32 playerJumpRiseVelocity[] = {
+    FIX32(-7.5), FIX32(-7), FIX32(-6.5), FIX32(-6), FIX32(-5.5), FIX32(-5), FIX32(-4.5), FIX32(-4),
+    FIX32(-3.5), FIX32(-3), FIX32(-2.5), FIX32(-2), FIX32(-1.5), FIX32(-1), FIX32(-0.5)
+};
+const MotionCurve playerJumpRise = { playerJumpRiseVelocity, 15 };
+
+// 3 frames, rises 6.0 px
+static const fix32 playerJumpCutRiseVelocity[] = {
+    FIX32(-3), FIX32(-2), FIX32(-1)
+};
+const MotionCurve playerJumpCutRise = { playerJumpCutRiseVelocity, 3 };
+
+// 13 frames, rises 45.5 px
+static const fix32 playerDoubleJumpRiseVelocity[] = {
+    FIX32(-6.5), FIX32(-6), FIX32(-5.5), FIX32(-5), FIX32(-4.5), FIX32(-4), FIX32(-3.5), FIX32(-3),
+    FIX32(-2.5), FIX32(-2), FIX32(-1.5), FIX32(-1), FIX32(-0.5)
+};
+const MotionCurve playerDoubleJumpRise = { playerDoubleJumpRiseVelocity, 13 };
+
+// 8 frames, 32.0 px, ease out
+static const fix32 playerDashCurveVelocity[] = {
+    FIX32(7.5), FIX32(6.5), FIX32(5.5), FIX32(4.5), FIX32(3.5), FIX32(2.5), FIX32(1.5), FIX32(0.5)
+};
+const MotionCurve playerDashCurve = { playerDashCurveVelocity, 8 };
@@ -1,13 +1,160 @@
 #include <genesis.h>
 #include "entities/player.h"
 #include "assetLoader.h"
+#include "entities/animData.h"
+#include "entities/motionData.h"
+#include "gameplay/stats.h"
+#include "systems/input.h"
 #include "core/config.h"
 #include "systems/physics.h"
 #include "systems/collision.h"
+#include "systems/physicsBatch.h"
+#include "systems/tileCollision.h"
+#include "systems/timerWheel.h"
+#include "systems/stateMachine.h"
+#include "world/mapStream.h"
 
 // Global player instance
 Player player;
 
+// Hitbox relative to the player position (top-left of the sprite)
+static const CollisionBox playerHitbox = { 0, 0, PLAYER_HITBOX_WIDTH, PLAYER_HITBOX_HEIGHT };
+
+// Sequences (with their boxes) are baked from res/anims.boxes; pSprite has
+// a single 6x6-tile frame so far, so they differ only in timing and boxes
+
+static void playSeq(const AnimSeq* seq) {
+    if (player.anim.anim != ANIM_SLOT_NONE) spriteAnimPlay(&player.anim, 0, seq);
+}
+
+static bool attackDone() {
+    return player.anim.anim == ANIM_SLOT_NONE || animFinished(player.anim.anim);
+}
+
+// ============================================================================
+// States
+// ============================================================================
+
+// State flags
+#define PLAYER_NO_MOVE 0x01         // D-pad ignored
+#define PLAYER_NO_JUMP 0x02         // Jumps refused (attacks and parries may jump)
+#define PLAYER_NO_PHYSICS 0x04      // No gravity or friction (moves along the dash curve)
+#define PLAYER_LOCKED (PLAYER_NO_MOVE | PLAYER_NO_JUMP)
+
+// Changes allowed while an attack or parry plays out (a dash cancels an attack)
+#define PLAYER_HIT_STATES (STATE_BIT(PLAYER_STATE_HURT) | STATE_BIT(PLAYER_STATE_DEAD))
+#define PLAYER_ATTACK_EXITS (PLAYER_HIT_STATES | STATE_BIT(PLAYER_STATE_DASHING))
+
+// There is no game over yet: a dead player stays controllable as before
+#define PLAYER_DEAD_EXITS STATE_ALL
+
+static const StateDef playerStates[PLAYER_STATE_COUNT];
+
+static bool canEnter(PlayerState state) {
+    return stateAllows(playerStates, player.currentState, state);
+}
+
+/**
+ * A state that ran its course goes back to idle (if the player is still in it).
+ */
+static bool endState(PlayerState state) {
+    if (player.currentState != state) return FALSE;
+
+    stateForce(playerStates, &player.currentState, PLAYER_STATE_IDLE, &player);
+    return TRUE;
+}
+
+// State timers (fired by timerUpdate() after the player update)
+
+static void dashEnd(u16 arg) {
+    (void) arg;
+    endState(PLAYER_STATE_DASHING);
+}
+
+static void parryEnd(u16 arg) {
+    (void) arg;
+    endState(PLAYER_STATE_PARRYING);
+}
+
+static void hurtEnd(u16 arg) {
+    (void) arg;
+    endState(PLAYER_STATE_HURT);
+}
+
+static void idleEnter(void* owner) {
+    (void) owner;
+    player.velX = FIX32(0);
+}
+
+static void airUpdate(void* owner) {
+    (void) owner;
+    if (player.velY > FIX32(0)) setPlayerState(PLAYER_STATE_FALLING);
+}
+
+static void dashEnter(void* owner) {
+    (void) owner;
+    // The dash replaces any jump in progress and lasts as long as its curve
+    player.rise = NULL;
+    player.dashFrame = 0;
+    player.dashTimer = timerStart(playerDashCurve.length, dashEnd, 0);
+    player.canDash = FALSE;
+    player.dashCooldown = timerStartFlag(PLAYER_DASH_COOLDOWN, &player.canDash);
+}
+
+static void attackEnter(void* owner) {
+    (void) owner;
+    // The attack sequence's frames carry the hitboxes
+    playSeq(&playerAttackSeq);
+}
+
+static void attackUpdate(void* owner) {
+    (void) owner;
+    // Back to idle once the attack sequence has played out
+    if (attackDone()) endState(PLAYER_STATE_ATTACKING);
+}
+
+static void attackExit(void* owner) {
+    (void) owner;
+    playSeq(&playerIdleSeq);
+}
+
+static void parryEnter(void* owner) {
+    (void) owner;
+    // The guard box is out for the whole window
+    player.parryWindow = timerStart(PLAYER_PARRY_WINDOW, parryEnd, 0);
+    player.velX = FIX32(0);
+    playSeq(&playerParrySeq);
+}
+
+static void parryExit(void* owner) {
+    (void) owner;
+    timerCancel(player.parryWindow);    // A hit breaks the guard
+    playSeq(&playerIdleSeq);
+}
+
+static void hurtEnter(void* owner) {
+    (void) owner;
+    player.rise = NULL;
+    player.hurtTimer = timerStart(PLAYER_HURT_DURATION, hurtEnd, 0);
+}
+
+// Indexed by PlayerState. Attacks, parries and stuns can only be left
+// early by a hit (attacks also by a dash), dashes not at all; they end
+// themselves. Leaving an attack or parry goes back to the idle sequence.
+static const StateDef playerStates[PLAYER_STATE_COUNT] = {
+    //                            allowed                       flags                               enter        update        exit
+    [PLAYER_STATE_IDLE]      = { STATE_ALL,                    0,                                  idleEnter,   NULL,         NULL },
+    [PLAYER_STATE_RUNNING]   = { STATE_ALL,                    0,                                  NULL,        NULL,         NULL },
+    [PLAYER_STATE_JUMPING]   = { STATE_ALL,                    0,                                  NULL,        airUpdate,    NULL },
+    [PLAYER_STATE_FALLING]   = { STATE_ALL,                    0,                                  NULL,        NULL,         NULL },
+    [PLAYER_STATE_DASHING]   = { 0,                            PLAYER_LOCKED | PLAYER_NO_PHYSICS,  dashEnter,   NULL,         NULL },
+    [PLAYER_STATE_ATTACKING] = { PLAYER_ATTACK_EXITS,          0,                                  attackEnter, attackUpdate, attackExit },
+    [PLAYER_STATE_PARRYING]  = { PLAYER_HIT_STATES,            0,                                  parryEnter,  NULL,         parryExit },
+    [PLAYER_STATE_BLOCKING]  = { STATE_ALL,                    0,                                  NULL,        NULL,         NULL },
+    [PLAYER_STATE_HURT]      = { STATE_BIT(PLAYER_STATE_DEAD), PLAYER_LOCKED,                      hurtEnter,   NULL,         NULL },
+    [PLAYER_STATE_DEAD]      = { PLAYER_DEAD_EXITS,            0,                                  NULL,        NULL,         NULL },
+};
+
 void playerInit() {
     // Initialize position (center of screen)
     player.posX = FIX32(160);
@@ -27,31 +174,58 @@ void playerInit() {
     player.facingRight = TRUE;
     
     // Initialize abilities (locked at start)
-    player.canDash = FALSE;
-    player.dashCooldown = 0;
-    player.dashTimer = 0;
+    player.canDash = TRUE;
+    player.dashCooldown = TIMER_NONE;
+    player.dashTimer = TIMER_NONE;
     player.hasDashAbility = FALSE;
     
     player.canDoubleJump = FALSE;
     player.hasDoubleJumpAbility = FALSE;
+    player.rise = NULL;
+    player.riseFrame = 0;
+    player.dashFrame = 0;
     
-    player.parryWindow = PLAYER_PARRY_WINDOW;
+    player.parryWindow = TIMER_NONE;
     player.hasParryAbility = FALSE;
     
+    player.hurtTimer = TIMER_NONE;
+    
     // Sprite reference will be set by asset loader
     player.sprite = playerSprite;
+    player.anim.anim = ANIM_SLOT_NONE;
+    if (player.sprite) spriteAnimBind(&player.anim, player.sprite, 0, &playerIdleSeq, 0);
+    
+    // Action buttons go through the input queue
+    playerBindInput();
+    
+    // Register with the batched physics stage
+    player.body = bodyAdd(player.posX, player.posY,
+                          PLAYER_MAX_SPEED_X, MAX_FALL_SPEED, BODY_DYNAMIC);
 }
 
 void playerUpdate() {
+    u8 bodyFlags = 0;
+    
     // Check ground collision
-    player.onGround = checkGroundCollision(player.posY);
+    player.onGround = checkGroundCollision(player.posX, player.posY, &playerHitbox);
     
-    // Apply physics if not dashing
-    if (player.currentState != PLAYER_STATE_DASHING) {
-        // Apply gravity if not on ground
-        if (!player.onGround) {
-            applyGravity(&player.velY);
+    if (stateFlags(playerStates, player.currentState) & PLAYER_NO_PHYSICS) {
+        // Dashing: the curve's speed in the facing direction, level
+        fix32 speed = motionVelocity(&playerDashCurve, player.dashFrame++);
+        
+        player.velX = player.facingRight ? speed : -speed;
+        player.velY = FIX32(0);
+        bodyFlags = BODY_INTEGRATE;
+    } else {
+        // Rising along a jump curve, else gravity if not on ground
+        if (player.rise) {
+            player.velY = motionVelocity(player.rise, player.riseFrame);
+            if (++player.riseFrame >= player.rise->length) player.rise = NULL;
+        } else if (!player.onGround) {
+            bodyFlags |= BODY_GRAVITY;
         } else {
+            bodyFlags |= BODY_ON_GROUND;
+            
             // On ground - stop falling
             if (player.velY > FIX32(0)) {
                 player.velY = FIX32(0);
@@ -60,7 +234,7 @@ void playerUpdate() {
             // If was jumping/falling, return to idle or running
             if (player.currentState == PLAYER_STATE_JUMPING || 
                 player.currentState == PLAYER_STATE_FALLING) {
-                s16 velXInt = player.velX >> 16; // Convert fix32 to int
+                s16 velXInt = F32_toInt(player.velX);
                 if (velXInt == 0) {
                     setPlayerState(PLAYER_STATE_IDLE);
                 } else {
@@ -69,103 +243,65 @@ void playerUpdate() {
             }
         }
         
-        // Apply friction
-        applyFriction(&player.velX, &player.velY, player.onGround);
-        
-        // Update position based on velocity
-        integrateVelocity(&player.posX, &player.posY, player.velX, player.velY);
+        // Apply friction, then update position based on velocity
+        bodyFlags |= BODY_FRICTION | BODY_INTEGRATE;
     }
     
-    // Handle state-specific updates
-    switch (player.currentState) {
-        case PLAYER_STATE_DASHING:
-            // Update dash timer
-            if (player.dashTimer > 0) {
-                player.dashTimer--;
-            } else {
-                setPlayerState(PLAYER_STATE_IDLE);
-                player.canDash = FALSE;
-            }
-            break;
-            
-        case PLAYER_STATE_PARRYING:
-            // Update parry window
-            if (player.parryWindow > 0) {
-                player.parryWindow--;
-            } else {
-                setPlayerState(PLAYER_STATE_IDLE);
-            }
-            break;
-            
-        case PLAYER_STATE_JUMPING:
-        case PLAYER_STATE_FALLING:
-            // Check if we should transition to falling
-            if (player.velY > FIX32(0) && player.currentState == PLAYER_STATE_JUMPING) {
-                setPlayerState(PLAYER_STATE_FALLING);
-            }
-            break;
-            
-        default:
-            break;
-    }
+    // Hand the player over to the physics stage
+    physBodies.posX[player.body] = player.posX;
+    physBodies.posY[player.body] = player.posY;
+    physBodies.velX[player.body] = player.velX;
+    physBodies.velY[player.body] = player.velY;
+    bodySetFlags(player.body, bodyFlags);
+}
+
+void playerPostPhysics() {
+    fix32 prevPosY = player.posY;
     
-    // Update dash cooldown
-    if (player.dashCooldown > 0) {
-        player.dashCooldown--;
-    } else {
-        player.canDash = TRUE;
-    }
+    // Take back the integrated position and velocity
+    player.posX = physBodies.posX[player.body];
+    player.velX = physBodies.velX[player.body];
+    player.velY = physBodies.velY[player.body];
+    
+    // Resolve against the zone's tile collision, one axis at a time
+    tileResolveX(&player.posX, prevPosY, &player.velX, &playerHitbox);
+    player.posY = physBodies.posY[player.body];
+    tileResolveY(&player.posY, prevPosY, player.posX, &player.velY, &playerHitbox);
+    
+    // A head bump ends the rise (curves never hold a zero velocity)
+    if (player.rise && player.velY == FIX32(0)) player.rise = NULL;
+    
+    // Handle state-specific updates (dash, parry and hurt end on timers)
+    stateUpdate(playerStates, player.currentState, &player);
     
     // Regenerate stamina slowly
-    if (player.stamina < player.maxStamina) {
-        player.stamina++;
-    }
+    regenStamina();
     
     // Keep player in bounds
+    fix32 maxPosX = FIX32(mapStreamWidth() - PLAYER_HITBOX_WIDTH);
     if (player.posX < FIX32(0)) {
         player.posX = FIX32(0);
         player.velX = FIX32(0);
     }
-    if (player.posX > FIX32(SCREEN_WIDTH - 16)) {
-        player.posX = FIX32(SCREEN_WIDTH - 16);
+    if (player.posX > maxPosX) {
+        player.posX = maxPosX;
         player.velX = FIX32(0);
     }
     
-    // Update sprite position
+    // Update sprite facing and frame (position is set by the camera)
     if (player.sprite) {
-        s16 spriteX = player.posX >> 16; // Convert fix32 to int
-        s16 spriteY = player.posY >> 16;
-        SPR_setPosition(player.sprite, spriteX, spriteY);
         SPR_setHFlip(player.sprite, !player.facingRight);
+        spriteAnimSync(&player.anim);
     }
 }
 
-void setPlayerState(PlayerState newState) {
-    // Validate state transitions
-    PlayerState oldState = player.currentState;
-    
-    // Some states can't be interrupted
-    if (oldState == PLAYER_STATE_DASHING && player.dashTimer > 0) {
-        return; // Can't interrupt dash
-    }
-    
-    if (oldState == PLAYER_STATE_HURT) {
-        return; // Can't interrupt hurt state
-    }
-    
-    // Update state
-    player.currentState = newState;
-    
-    // Reset velocity when entering idle
-    if (newState == PLAYER_STATE_IDLE) {
-        player.velX = FIX32(0);
-    }
+bool setPlayerState(PlayerState newState) {
+    return stateChange(playerStates, &player.currentState, newState, &player);
 }
 
 void movePlayerRight() {
-    // Can't move while dashing or hurt
-    if (player.currentState == PLAYER_STATE_DASHING || 
-        player.currentState == PLAYER_STATE_HURT) {
+    // Can't move while dashing, hurt or dead
+    if (stateFlags(playerStates, player.currentState) & PLAYER_NO_MOVE) {
         return;
     }
     
@@ -173,16 +309,15 @@ void movePlayerRight() {
     player.velX = PLAYER_WALK_SPEED;
     player.facingRight = TRUE;
     
-    // Update state if on ground
-    if (player.onGround) {
+    // Update state if on ground (not on a jump's first frame)
+    if (player.onGround && !player.rise) {
         setPlayerState(PLAYER_STATE_RUNNING);
     }
 }
 
 void movePlayerLeft() {
-    // Can't move while dashing or hurt
-    if (player.currentState == PLAYER_STATE_DASHING || 
-        player.currentState == PLAYER_STATE_HURT) {
+    // Can't move while dashing, hurt or dead
+    if (stateFlags(playerStates, player.currentState) & PLAYER_NO_MOVE) {
         return;
     }
     
@@ -190,131 +325,144 @@ void movePlayerLeft() {
     player.velX = -PLAYER_WALK_SPEED;
     player.facingRight = FALSE;
     
-    // Update state if on ground
-    if (player.onGround) {
+    // Update state if on ground (not on a jump's first frame)
+    if (player.onGround && !player.rise) {
         setPlayerState(PLAYER_STATE_RUNNING);
     }
 }
 
-void playerJump() {
+static void startRise(const MotionCurve* curve, u8 frame) {
+    player.rise = curve;
+    player.riseFrame = frame;
+    player.velY = motionVelocity(curve, frame);
+}
+
+/**
+ * Jump button let go: finish the rise on the short curve, picking it up at
+ * the current speed or slower.
+ */
+static void cutJump() {
+    if (!player.rise || player.rise == &playerJumpCutRise) return;
+    
+    u8 frame = motionFind(&playerJumpCutRise, motionVelocity(player.rise, player.riseFrame));
+    if (frame < playerJumpCutRise.length) startRise(&playerJumpCutRise, frame);
+    else player.rise = NULL;
+}
+
+bool playerJump() {
+    if (stateFlags(playerStates, player.currentState) & PLAYER_NO_JUMP) {
+        return FALSE;
+    }
+    
     // Can only jump if on ground or have double jump
     if (player.onGround) {
-        player.velY = PLAYER_JUMP_VELOCITY;
+        startRise(&playerJumpRise, 0);
         setPlayerState(PLAYER_STATE_JUMPING);
         player.canDoubleJump = player.hasDoubleJumpAbility;
     } else if (player.canDoubleJump && player.hasDoubleJumpAbility) {
         // Double jump
-        player.velY = PLAYER_JUMP_VELOCITY;
+        startRise(&playerDoubleJumpRise, 0);
         player.canDoubleJump = FALSE;
+    } else {
+        return FALSE;
     }
+    return TRUE;
 }
 
-void playerDash() {
+bool playerDash() {
     // Check if can dash
-    if (!player.hasDashAbility || !player.canDash) {
-        return;
+    if (!player.hasDashAbility || !player.canDash || !canEnter(PLAYER_STATE_DASHING)) {
+        return FALSE;
     }
     
     // Check stamina
     if (player.stamina < 20) {
-        return;
+        return FALSE;
     }
     
     // Consume stamina
     player.stamina -= 20;
     
-    // Set dash state
+    // Set dash state (starts the timers; playerUpdate moves along the curve)
     setPlayerState(PLAYER_STATE_DASHING);
-    player.dashTimer = PLAYER_DASH_DURATION;
-    player.dashCooldown = 30; // 0.5 second cooldown at 60fps
-    
-    // Apply dash velocity in facing direction
-    if (player.facingRight) {
-        player.velX = FIX32(8.0);
-    } else {
-        player.velX = FIX32(-8.0);
-    }
-    player.velY = FIX32(0);
+    return TRUE;
 }
 
-void playerParry() {
+bool playerParry() {
     // Check if has ability
     if (!player.hasParryAbility) {
-        return;
-    }
-    
-    // Can't parry in certain states
-    if (player.currentState == PLAYER_STATE_DASHING ||
-        player.currentState == PLAYER_STATE_HURT) {
-        return;
+        return FALSE;
     }
     
-    // Enter parry state
-    setPlayerState(PLAYER_STATE_PARRYING);
-    player.parryWindow = PLAYER_PARRY_WINDOW;
-    player.velX = FIX32(0);
+    // Enter parry state (not while dashing, hurt or already busy)
+    return setPlayerState(PLAYER_STATE_PARRYING);
 }
 
-void playerAttack() {
-    // Basic attack stub - to be implemented
+bool playerAttack() {
     // Check stamina
     if (player.stamina < 10) {
-        return;
+        return FALSE;
     }
     
-    // Can't attack in certain states
-    if (player.currentState == PLAYER_STATE_DASHING ||
-        player.currentState == PLAYER_STATE_PARRYING ||
-        player.currentState == PLAYER_STATE_HURT) {
-        return;
+    // Can't attack in certain states (one attack at a time)
+    if (!canEnter(PLAYER_STATE_ATTACKING)) {
+        return FALSE;
     }
     
     // Consume stamina
     player.stamina -= 10;
     
-    // Set attack state (to be implemented with animation)
     setPlayerState(PLAYER_STATE_ATTACKING);
+    return TRUE;
+}
+
+bool playerHurt(u16 damage, bool knockRight) {
+    // Dashes pass through hits; hurt gives a short invulnerability
+    if (!canEnter(PLAYER_STATE_HURT) || player.health == 0) {
+        return FALSE;
+    }
+    
+    if (!takeDamage(damage)) {
+        return TRUE;
+    }
+    
+    setPlayerState(PLAYER_STATE_HURT);
+    player.velX = knockRight ? PLAYER_HURT_KNOCKBACK : -PLAYER_HURT_KNOCKBACK;
+    return TRUE;
+}
+
+const FrameBoxes* playerBoxes() {
+    if (player.anim.anim == ANIM_SLOT_NONE) return playerIdleSeq.boxes;
+    return animBoxes(player.anim.anim);
 }
 
 // ============================================================================
 // Input Handling (merged from playerController)
 // ============================================================================
 
-void playerJoyEvent(u16 joy, u16 changed, u16 state) {
-    // Only handle input from first controller
-    if (joy != JOY_1) return;
+// Jump is also read held: letting go while rising cuts the jump short
+#define PLAYER_BUTTON_JUMP BUTTON_B
 
-    // Check for button presses (changed & state = newly pressed)
-    if (changed & state) {
-        // Jump button (B)
-        if (changed & state & BUTTON_B) {
-            playerJump();
-        }
-
-        // Dash button (A) - if ability unlocked
-        if (changed & state & BUTTON_A) {
-            if (player.hasDashAbility) {
-                playerDash();
-            }
-        }
+// Dash and parry refuse until their ability is unlocked
+static const InputBinding playerBindings[] = {
+    { PLAYER_BUTTON_JUMP, INPUT_BUFFER_JUMP, playerJump },
+    { BUTTON_A, INPUT_BUFFER_DASH, playerDash },
+    { BUTTON_C, INPUT_BUFFER_PARRY, playerParry },
+    { BUTTON_X | BUTTON_Y | BUTTON_Z, INPUT_BUFFER_ATTACK, playerAttack },   // 6-button pad
+};
 
-        // Parry button (C) - if ability unlocked
-        if (changed & state & BUTTON_C) {
-            if (player.hasParryAbility) {
-                playerParry();
-            }
-        }
-
-        // Attack button (X/Y/Z) - for 6-button controller
-        if (changed & state & (BUTTON_X | BUTTON_Y | BUTTON_Z)) {
-            playerAttack();
-        }
-    }
+void playerBindInput() {
+    inputSetBindings(playerBindings, sizeof(playerBindings) / sizeof(playerBindings[0]));
 }
 
 void playerHandleInput() {
-    // Read current joystick state
-    u16 joyValue = JOY_readJoypad(JOY_1);
+    // Current joystick state (sampled once per frame by inputPoll)
+    u16 joyValue = inputPad();
+
+    // Letting go of jump while rising makes a short hop
+    if (!(joyValue & PLAYER_BUTTON_JUMP)) {
+        cutJump();
+    }
 
     // If both left and right are pressed, do nothing
     if ((joyValue & BUTTON_RIGHT) && (joyValue & BUTTON_LEFT)) {
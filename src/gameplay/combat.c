@@ -0,0 +1,60 @@
+#include <genesis.h>
+#include "gameplay/combat.h"
+#include "entities/entity.h"
+#include "entities/player.h"
+#include "systems/hitbox.h"
+#include "world/objectSpawner.h"
+
+CombatStats combatStats;
+
+void combatInit() {
+    hitboxInit();
+    memset(&combatStats, 0, sizeof(combatStats));
+}
+
+static void playerHitsEntity(Entity* e) {
+    objectSpawnerCollect(e);
+    entityDespawn(entityHandleOf(e));
+    combatStats.defeats++;
+}
+
+static void entityHitsPlayer(Entity* e) {
+    bool fromLeft = F32_toInt(e->posX) < F32_toInt(player.posX);
+
+    if (player.currentState == PLAYER_STATE_PARRYING) {
+        if (e->type == ENTITY_TYPE_PROJECTILE) {
+            entityDespawn(entityHandleOf(e));
+        } else if (!entitySetState(e, ENEMY_STATE_RECOIL)) {
+            return;     // Already backing off
+        }
+        combatStats.parries++;
+        return;
+    }
+
+    if (!playerHurt(COMBAT_CONTACT_DAMAGE, fromLeft)) return;
+    combatStats.playerHits++;
+
+    // Shots are spent on contact
+    if (e->type == ENTITY_TYPE_PROJECTILE) entityDespawn(entityHandleOf(e));
+}
+
+static void onHit(u16 attacker, u16 victim) {
+    // Either side may have been despawned by an earlier hit this frame
+    if (attacker == COMBAT_PLAYER_ID) {
+        Entity* e = entityGet(victim);
+        if (e) playerHitsEntity(e);
+    } else if (victim == COMBAT_PLAYER_ID) {
+        Entity* e = entityGet(attacker);
+        if (e) entityHitsPlayer(e);
+    }
+}
+
+void combatUpdate() {
+    hitboxBegin();
+
+    hitboxSubmit(COMBAT_PLAYER_ID, COMBAT_TEAM_PLAYER, F32_toInt(player.posX), F32_toInt(player.posY),
+                 PLAYER_HITBOX_WIDTH, player.facingRight, playerBoxes());
+    entitySubmitHitboxes(COMBAT_TEAM_ENEMY);
+
+    hitboxResolve(onHit);
+}
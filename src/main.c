@@ -3,27 +3,68 @@
 #include "core/config.h"
 #include "camera.h"
 #include "assetLoader.h"
+#include "core/profiler.h"
+#include "systems/transfer.h"
+#include "systems/scroll.h"
+#include "systems/parallax.h"
+#include "systems/spriteSched.h"
+#include "systems/spriteAnim.h"
 
 int main() {
+    #ifdef PROFILE_ENABLED
+    u16 profiledFrames = 0;
+    #endif
+
     // Initialize all game systems
     gameInit();
     
     // Main game loop
     while (1) {
+        PROF_FRAME_BEGIN();
+
         // Update game state
+        PROF_BEGIN(PROF_GAME_UPDATE);
         gameUpdate();
+        PROF_END(PROF_GAME_UPDATE);
         
         // Update camera
+        PROF_BEGIN(PROF_CAMERA);
         mainCamera();
+        PROF_END(PROF_CAMERA);
         
-        // Update background scrolling
-        updateBackgroundScroll();
+        // Compute every plane offset from the camera, one table upload each
+        PROF_BEGIN(PROF_BG_SCROLL);
+        parallaxUpdate();
+        scrollUpdate();
+        PROF_END(PROF_BG_SCROLL);
         
-        // Update all sprites
+        // Rotate the link order if a scanline is over budget, then update sprites
+        PROF_BEGIN(PROF_SPR_UPDATE);
+        spriteSchedUpdate();
+        spriteAnimEndFrame();
         SPR_update();
+        PROF_END(PROF_SPR_UPDATE);
+
+        // Hand queued VRAM work to the DMA queue within the vblank budget
+        PROF_BEGIN(PROF_TRANSFER);
+        transferFlush();
+        PROF_END(PROF_TRANSFER);
         
         // Wait for VBlank and process
+        PROF_BEGIN(PROF_VBLANK);
         SYS_doVBlankProcess();
+        PROF_END(PROF_VBLANK);
+
+        PROF_FRAME_END();
+
+        #ifdef PROFILE_ENABLED
+        // Budget bars every frame, full min/avg/max dump once per history window
+        profDrawBars();
+        if (++profiledFrames >= PROF_HISTORY) {
+            profDump();
+            profiledFrames = 0;
+        }
+        #endif
     }
     
     return 0;
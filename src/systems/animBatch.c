@@ -0,0 +1,106 @@
+#include <genesis.h>
+#include "systems/animBatch.h"
+
+// All animations, struct-of-arrays
+AnimSlots animSlots;
+AnimBatchStats animBatchStats;
+
+static AnimEventHandler* eventHandlers[ANIM_EVENT_COUNT];
+
+void animBatchInit() {
+    memset(&animSlots, 0, sizeof(animSlots));
+    memset(&animBatchStats, 0, sizeof(animBatchStats));
+    memset(eventHandlers, 0, sizeof(eventHandlers));
+}
+
+void animSetEventHandler(AnimEvent event, AnimEventHandler* handler) {
+    if (event < ANIM_EVENT_COUNT) eventHandlers[event] = handler;
+}
+
+/**
+ * Enter a frame: reload the timer, flag the change, fire the event.
+ */
+static void enterFrame(u8 anim, u8 cursor) {
+    const AnimSeqFrame* f = &animSlots.seq[anim]->frames[cursor];
+
+    animSlots.cursor[anim] = cursor;
+    animSlots.timer[anim] = f->duration;
+    animSlots.flags[anim] |= ANIM_CHANGED;
+    animBatchStats.transitions++;
+
+    if (f->event) {
+        AnimEventHandler* handler = eventHandlers[f->event];
+        if (handler) {
+            handler(anim, animSlots.owner[anim], f->arg);
+            animBatchStats.events++;
+        }
+    }
+}
+
+u8 animAdd(const AnimSeq* seq, u8 owner) {
+    for (u8 i = 0; i < ANIM_MAX_SLOTS; i++) {
+        if (animSlots.flags[i] & ANIM_ACTIVE) continue;
+
+        animSlots.owner[i] = owner;
+        animSlots.flags[i] = ANIM_ACTIVE;
+        if (i >= animSlots.highWater) animSlots.highWater = i + 1;
+
+        animPlay(i, seq);
+        return i;
+    }
+    return ANIM_SLOT_NONE;
+}
+
+void animRemove(u8 anim) {
+    if (anim >= ANIM_MAX_SLOTS) return;
+
+    animSlots.flags[anim] = 0;
+
+    // Shrink the loop range when the top slots are free
+    while (animSlots.highWater > 0 &&
+           !(animSlots.flags[animSlots.highWater - 1] & ANIM_ACTIVE)) {
+        animSlots.highWater--;
+    }
+}
+
+void animPlay(u8 anim, const AnimSeq* seq) {
+    animSlots.seq[anim] = seq;
+    animSlots.flags[anim] = (animSlots.flags[anim] & (ANIM_ACTIVE | ANIM_PAUSED)) | (seq->loop ? ANIM_LOOP : 0);
+    enterFrame(anim, 0);
+}
+
+void animSeek(u8 anim, u8 cursor) {
+    if (cursor >= animSlots.seq[anim]->count) return;
+
+    animSlots.flags[anim] &= ~ANIM_FINISHED;
+    enterFrame(anim, cursor);
+}
+
+void animBatchUpdate() {
+    u8* cursor = animSlots.cursor;
+    u8* timer = animSlots.timer;
+    u8* flags = animSlots.flags;
+    u16 count = animSlots.highWater;
+
+    for (u16 i = 0; i < count; i++) {
+        u8 f = flags[i] & ~ANIM_CHANGED;
+        flags[i] = f;
+
+        if ((f & (ANIM_ACTIVE | ANIM_PAUSED)) != ANIM_ACTIVE) continue;
+
+        // Holding (ANIM_HOLD or finished) or not due yet
+        if (!timer[i] || --timer[i]) continue;
+
+        u8 next = cursor[i] + 1;
+        if (next >= animSlots.seq[i]->count) {
+            if (!(f & ANIM_LOOP)) {
+                flags[i] = f | ANIM_FINISHED;
+                continue;
+            }
+            next = 0;
+        }
+
+        // Only transitions reach here: events cost nothing on held frames
+        enterFrame(i, next);
+    }
+}
@@ -0,0 +1,147 @@
+#include <genesis.h>
+#include "systems/broadphase.h"
+
+#define GRID_CELLS (BROAD_GRID_W * BROAD_GRID_H)
+
+BroadStats broadStats;
+
+static CollisionBox boxes[BROAD_MAX_BOXES];
+static u16 boxCount;
+
+// Per-cell singly linked lists of box indices
+static u16 cellHead[GRID_CELLS];
+static u16 nodeBox[BROAD_MAX_NODES];
+static u16 nodeNext[BROAD_MAX_NODES];
+static u16 nodeCount;
+
+// Query de-duplication (a box covering several cells is seen once)
+static u16 queryStamp[BROAD_MAX_BOXES];
+static u16 currentStamp;
+
+static inline bool overlaps(const CollisionBox* a, const CollisionBox* b) {
+    return (a->x < b->x + (s16) b->width &&
+            a->x + (s16) a->width > b->x &&
+            a->y < b->y + (s16) b->height &&
+            a->y + (s16) a->height > b->y);
+}
+
+static inline u16 cellIndex(s16 cx, s16 cy) {
+    return ((cy & (BROAD_GRID_H - 1)) * BROAD_GRID_W) + (cx & (BROAD_GRID_W - 1));
+}
+
+static inline u16 cellOf(s16 x, s16 y) {
+    return cellIndex(x >> BROAD_CELL_SHIFT, y >> BROAD_CELL_SHIFT);
+}
+
+/**
+ * Cell range covered by a box, clamped to one grid's worth so a huge box
+ * doesn't wrap onto itself.
+ */
+static void cellRange(const CollisionBox* box, s16* cx0, s16* cy0, s16* cx1, s16* cy1) {
+    *cx0 = box->x >> BROAD_CELL_SHIFT;
+    *cy0 = box->y >> BROAD_CELL_SHIFT;
+    *cx1 = (box->x + (s16) box->width - 1) >> BROAD_CELL_SHIFT;
+    *cy1 = (box->y + (s16) box->height - 1) >> BROAD_CELL_SHIFT;
+
+    if (*cx1 - *cx0 >= BROAD_GRID_W) *cx1 = *cx0 + BROAD_GRID_W - 1;
+    if (*cy1 - *cy0 >= BROAD_GRID_H) *cy1 = *cy0 + BROAD_GRID_H - 1;
+}
+
+void broadClear() {
+    for (u16 i = 0; i < GRID_CELLS; i++) cellHead[i] = BROAD_NONE;
+
+    boxCount = 0;
+    nodeCount = 0;
+    memset(&broadStats, 0, sizeof(broadStats));
+}
+
+u16 broadInsert(const CollisionBox* box) {
+    s16 cx0, cy0, cx1, cy1;
+
+    if (boxCount >= BROAD_MAX_BOXES) return BROAD_NONE;
+
+    cellRange(box, &cx0, &cy0, &cx1, &cy1);
+    if (nodeCount + (cx1 - cx0 + 1) * (cy1 - cy0 + 1) > BROAD_MAX_NODES) return BROAD_NONE;
+
+    u16 index = boxCount++;
+    boxes[index] = *box;
+    queryStamp[index] = currentStamp;
+
+    for (s16 cy = cy0; cy <= cy1; cy++) {
+        for (s16 cx = cx0; cx <= cx1; cx++) {
+            u16 cell = cellIndex(cx, cy);
+            u16 node = nodeCount++;
+
+            nodeBox[node] = index;
+            nodeNext[node] = cellHead[cell];
+            cellHead[cell] = node;
+        }
+    }
+
+    broadStats.boxes = boxCount;
+    broadStats.nodes = nodeCount;
+    return index;
+}
+
+const CollisionBox* broadGetBox(u16 index) {
+    return &boxes[index];
+}
+
+u16 broadQuery(const CollisionBox* box, u16* out, u16 maxOut) {
+    s16 cx0, cy0, cx1, cy1;
+    u16 found = 0;
+
+    // New stamp; on wrap-around forget old stamps
+    if (++currentStamp == 0) {
+        memset(queryStamp, 0, sizeof(queryStamp));
+        currentStamp = 1;
+    }
+
+    cellRange(box, &cx0, &cy0, &cx1, &cy1);
+
+    for (s16 cy = cy0; cy <= cy1; cy++) {
+        for (s16 cx = cx0; cx <= cx1; cx++) {
+            for (u16 node = cellHead[cellIndex(cx, cy)]; node != BROAD_NONE; node = nodeNext[node]) {
+                u16 index = nodeBox[node];
+
+                if (queryStamp[index] == currentStamp) continue;
+                queryStamp[index] = currentStamp;
+
+                broadStats.tests++;
+                if (overlaps(box, &boxes[index])) {
+                    out[found++] = index;
+                    if (found >= maxOut) return found;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+u16 broadForEachPair(BroadPairCallback* callback) {
+    u16 pairs = 0;
+
+    for (u16 cell = 0; cell < GRID_CELLS; cell++) {
+        for (u16 nodeA = cellHead[cell]; nodeA != BROAD_NONE; nodeA = nodeNext[nodeA]) {
+            const CollisionBox* a = &boxes[nodeBox[nodeA]];
+
+            for (u16 nodeB = nodeNext[nodeA]; nodeB != BROAD_NONE; nodeB = nodeNext[nodeB]) {
+                const CollisionBox* b = &boxes[nodeBox[nodeB]];
+
+                broadStats.tests++;
+                if (!overlaps(a, b)) continue;
+
+                // Pairs sharing several cells are only reported from the cell
+                // holding the top-left corner of their intersection
+                if (cellOf(max(a->x, b->x), max(a->y, b->y)) != cell) continue;
+
+                pairs++;
+                callback(nodeBox[nodeA], nodeBox[nodeB]);
+            }
+        }
+    }
+
+    broadStats.pairs = pairs;
+    return pairs;
+}
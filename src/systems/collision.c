@@ -1,10 +1,8 @@
 #include <genesis.h>
 #include "systems/collision.h"
+#include "systems/tileCollision.h"
 #include "core/config.h"
 
-// Ground level for simple collision (will be improved with tilemap collision later)
-#define GROUND_Y 180
-
 bool collisionAABB(CollisionBox* box1, CollisionBox* box2) {
     if (!box1 || !box2) return FALSE;
     
@@ -23,8 +21,8 @@ bool collisionPointRect(s16 px, s16 py, CollisionBox* box) {
             py <= box->y + box->height);
 }
 
-bool checkGroundCollision(fix32 playerY) {
-    // Simple ground detection - convert fix32 to integer for comparison
-    s16 yPos = playerY >> 16; // Shift right by 16 bits for fix32 conversion
-    return yPos >= GROUND_Y;
+bool checkGroundCollision(fix32 posX, fix32 posY, const CollisionBox* box) {
+    // Probe the zone's collision layer just under the box's feet
+    return tileGroundUnder(F32_toInt(posX) + box->x, F32_toInt(posY) + box->y,
+                           box->width, box->height);
 }
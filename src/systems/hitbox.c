@@ -0,0 +1,155 @@
+#include <genesis.h>
+#include "systems/hitbox.h"
+
+HitboxStats hitboxStats;
+
+// Hurtboxes submitted this frame (into the grid one team at a time)
+static CollisionBox hurtBoxes[HITBOX_MAX_HURT];
+static u16 hurtOwner[HITBOX_MAX_HURT];
+static u8 hurtTeam[HITBOX_MAX_HURT];
+static u8 hurtCount;
+
+// Hurtbox behind each grid box of the current pass
+static u8 gridHurt[BROAD_MAX_BOXES];
+
+// Hitboxes out this frame
+static CollisionBox hitBoxes[HITBOX_MAX_ACTIVE];
+static u16 hitOwner[HITBOX_MAX_ACTIVE];
+static u8 hitTeam[HITBOX_MAX_ACTIVE];
+static u8 hitCount;
+
+void hitboxInit() {
+    memset(&hitboxStats, 0, sizeof(hitboxStats));
+    hurtCount = 0;
+    hitCount = 0;
+}
+
+void hitboxBegin() {
+    hurtCount = 0;
+    hitCount = 0;
+}
+
+/**
+ * Frame box to world box; facing left mirrors it across the actor width.
+ */
+static void place(CollisionBox* out, const FrameBox* b, s16 x, s16 y, u8 width, bool facingRight) {
+    out->x = facingRight ? x + b->x : x + (s16) width - b->x - (s16) b->width;
+    out->y = y + b->y;
+    out->width = b->width;
+    out->height = b->height;
+}
+
+void hitboxSubmit(u16 id, u8 team, s16 x, s16 y, u8 width, bool facingRight, const FrameBoxes* boxes) {
+    if (!boxes) return;
+
+    const FrameBox* b = boxes->boxes;
+
+    for (u8 i = 0; i < boxes->hurtCount; i++, b++) {
+        if (hurtCount >= HITBOX_MAX_HURT) {
+            hitboxStats.dropped++;
+            continue;
+        }
+        place(&hurtBoxes[hurtCount], b, x, y, width, facingRight);
+        hurtOwner[hurtCount] = id;
+        hurtTeam[hurtCount] = team;
+        hurtCount++;
+    }
+
+    for (u8 i = 0; i < boxes->hitCount; i++, b++) {
+        if (hitCount >= HITBOX_MAX_ACTIVE) {
+            hitboxStats.dropped++;
+            continue;
+        }
+        place(&hitBoxes[hitCount], b, x, y, width, facingRight);
+        hitOwner[hitCount] = id;
+        hitTeam[hitCount] = team;
+        hitCount++;
+    }
+}
+
+/**
+ * One team's hurtboxes against every other team's hitboxes. Only that team's
+ * hurtboxes are in the grid, so queries never return a box they would skip.
+ */
+static u8 resolveTeam(u8 team, u16* pairAttacker, u16* pairVictim, u8 hits) {
+    u16 candidates[HITBOX_MAX_CANDIDATES];
+    bool attacked = FALSE;
+
+    for (u8 h = 0; h < hitCount; h++) {
+        if (hitTeam[h] != team) attacked = TRUE;
+    }
+    if (!attacked) return hits;
+
+    broadClear();
+    for (u8 i = 0; i < hurtCount; i++) {
+        if (hurtTeam[i] != team) continue;
+
+        u16 index = broadInsert(&hurtBoxes[i]);
+        if (index == BROAD_NONE) {
+            hitboxStats.dropped++;
+            continue;
+        }
+        gridHurt[index] = i;
+    }
+
+    for (u8 h = 0; h < hitCount; h++) {
+        if (hitTeam[h] == team) continue;
+
+        u16 found = broadQuery(&hitBoxes[h], candidates, HITBOX_MAX_CANDIDATES);
+
+        for (u16 c = 0; c < found; c++) {
+            u16 victim = hurtOwner[gridHurt[candidates[c]]];
+
+            // Several boxes of one actor overlapping another still make one hit
+            bool seen = FALSE;
+            for (u8 p = 0; p < hits; p++) {
+                if (pairAttacker[p] == hitOwner[h] && pairVictim[p] == victim) {
+                    seen = TRUE;
+                    break;
+                }
+            }
+            if (seen || hits >= HITBOX_MAX_HITS) continue;
+
+            pairAttacker[hits] = hitOwner[h];
+            pairVictim[hits] = victim;
+            hits++;
+        }
+    }
+
+    hitboxStats.tests += broadStats.tests;
+    return hits;
+}
+
+u8 hitboxResolve(HitHandler* handler) {
+    u16 pairAttacker[HITBOX_MAX_HITS];
+    u16 pairVictim[HITBOX_MAX_HITS];
+    u8 teamsDone[HITBOX_MAX_HURT];
+    u8 teams = 0;
+    u8 hits = 0;
+
+    hitboxStats.tests = 0;
+
+    // One grid pass per team that has hurtboxes out
+    for (u8 i = 0; i < hurtCount; i++) {
+        bool done = FALSE;
+        for (u8 t = 0; t < teams; t++) {
+            if (teamsDone[t] == hurtTeam[i]) done = TRUE;
+        }
+        if (done) continue;
+
+        teamsDone[teams++] = hurtTeam[i];
+        hits = resolveTeam(hurtTeam[i], pairAttacker, pairVictim, hits);
+    }
+
+    hitboxStats.hurtboxes = hurtCount;
+    hitboxStats.hitboxes = hitCount;
+    hitboxStats.hits = hits;
+    hitboxStats.testsTotal += hitboxStats.tests;
+    hitboxStats.hitsTotal += hits;
+    if (hitboxStats.tests > hitboxStats.peakTests) hitboxStats.peakTests = hitboxStats.tests;
+
+    // Report after the queries, so handlers can despawn freely
+    for (u8 p = 0; p < hits; p++) handler(pairAttacker[p], pairVictim[p]);
+
+    return hits;
+}
@@ -2,20 +2,228 @@
 #include "systems/input.h"
 #include "entities/player.h"
 
+InputTapeStats inputTapeStats;
+InputQueueStats inputQueueStats;
+
+static InputMode mode;
+static u16 pad;             // This frame's sample
+static u16 frame;           // Frames sampled, stamps the edges
+
+// Edge ring: head is written by the producer only, tail by the consumer only
+static InputEvent queue[INPUT_QUEUE_SIZE];
+static volatile u8 queueHead;
+static volatile u8 queueTail;
+
+// Bindings and their buffered presses
+static const InputBinding* bindings;
+static u8 bindingCount;
+static bool pending[INPUT_MAX_BINDINGS];
+static u16 pressedAt[INPUT_MAX_BINDINGS];
+
+// Tape being recorded or replayed
+static u16* recordBuffer;
+static const u16* replayTape;
+static u32 tapeCapacity;
+static u32 tapeLength;
+static u32 tapePos;
+
+// Current run: state and frames (recording: so far; replay: left)
+static u16 runPad;
+static u16 runFrames;
+
 void inputInit() {
-    // Initialize joystick system
+    // Initialize joystick system; edges are derived from the polled state,
+    // so no SGDK event handler is installed
     JOY_init();
 
-    // Set up event handler for button presses
-    JOY_setEventHandler(&playerJoyEvent);
+    mode = INPUT_LIVE;
+    pad = 0;
+    frame = 0;
+    queueHead = 0;
+    queueTail = 0;
+    bindings = NULL;
+    bindingCount = 0;
+    runFrames = 0;
+    memset(&inputTapeStats, 0, sizeof(inputTapeStats));
+    memset(&inputQueueStats, 0, sizeof(inputQueueStats));
+}
+
+void inputSetBindings(const InputBinding* table, u8 count) {
+    bindings = table;
+    bindingCount = min(count, INPUT_MAX_BINDINGS);
+    memset(pending, 0, sizeof(pending));
+}
+
+/**
+ * Write the pending run. Returns FALSE (and stops recording) when full.
+ */
+static bool flushRun() {
+    if (!runFrames) return TRUE;
+
+    u16 words = (runFrames > INPUT_RUN_SHORT) ? 2 : 1;
+    if (tapeLength + words > tapeCapacity) {
+        inputTapeStats.overflow = TRUE;
+        mode = INPUT_LIVE;
+        return FALSE;
+    }
+
+    if (words == 1) {
+        recordBuffer[tapeLength++] = (runFrames << INPUT_RUN_SHIFT) | runPad;
+    } else {
+        recordBuffer[tapeLength++] = runPad;
+        recordBuffer[tapeLength++] = runFrames;
+    }
+
+    inputTapeStats.runs++;
+    inputTapeStats.words = tapeLength;
+    runFrames = 0;
+    return TRUE;
+}
+
+static void recordFrame() {
+    if (runFrames && (pad != runPad || runFrames == 0xFFFF)) {
+        if (!flushRun()) return;
+    }
+    runPad = pad;
+    runFrames++;
+    inputTapeStats.frames++;
+}
+
+static u16 replayFrame() {
+    if (inputTapeStats.ended) return 0;
+
+    if (!runFrames) {
+        if (tapePos < tapeLength) {
+            u16 word = replayTape[tapePos++];
+            runPad = word & INPUT_PAD_MASK;
+            runFrames = word >> INPUT_RUN_SHIFT;
+            if (!runFrames && tapePos < tapeLength) runFrames = replayTape[tapePos++];
+        }
+
+        // Out of tape (or a truncated long run)
+        if (!runFrames) {
+            inputTapeStats.ended = TRUE;
+            return 0;
+        }
+
+        inputTapeStats.runs++;
+        inputTapeStats.words = tapePos;
+    }
+
+    runFrames--;
+    inputTapeStats.frames++;
+    return runPad;
+}
+
+void inputPoll() {
+    u16 prevPad = pad;
+
+    if (mode == INPUT_REPLAY) {
+        // Out of tape, a replay stays idle rather than switching to the pad
+        pad = replayFrame();
+    } else {
+        pad = JOY_readJoypad(JOY_1) & INPUT_PAD_MASK;
+        if (mode == INPUT_RECORD) recordFrame();
+    }
+
+    frame++;
+
+    u16 changed = pad ^ prevPad;
+    if (!changed) return;
+
+    u8 head = queueHead;
+    u8 next = (head + 1) & (INPUT_QUEUE_SIZE - 1);
+    if (next == queueTail) {
+        inputQueueStats.overflows++;
+        return;
+    }
+
+    // Fill the slot, then publish it
+    queue[head].frame = frame;
+    queue[head].pressed = changed & pad;
+    queue[head].released = changed & ~pad;
+    queueHead = next;
+    inputQueueStats.events++;
+}
+
+u16 inputPad() {
+    return pad;
 }
 
 void inputUpdate() {
-    // Delegate to player input handler
+    // Drain the ring in order; a press (re)arms its bindings with its stamp
+    while (queueTail != queueHead) {
+        const InputEvent* e = &queue[queueTail];
+
+        for (u8 i = 0; i < bindingCount; i++) {
+            if (e->pressed & bindings[i].buttons) {
+                pending[i] = TRUE;
+                pressedAt[i] = e->frame;
+            }
+        }
+        queueTail = (queueTail + 1) & (INPUT_QUEUE_SIZE - 1);
+    }
+
+    // Run what is pending, in binding order; failures wait out their window
+    for (u8 i = 0; i < bindingCount; i++) {
+        if (!pending[i]) continue;
+
+        u16 age = frame - pressedAt[i];
+
+        if (age > bindings[i].window) {
+            pending[i] = FALSE;
+            inputQueueStats.expired++;
+        } else if (bindings[i].action()) {
+            pending[i] = FALSE;
+            inputQueueStats.actions++;
+            inputQueueStats.latencyTotal += age;
+            inputQueueStats.latencyLast = age;
+            if (age > inputQueueStats.latencyMax) inputQueueStats.latencyMax = age;
+            if (age) inputQueueStats.buffered++;
+        }
+    }
+
+    // Delegate continuous input to the player
     playerHandleInput();
 }
 
-void joyEventHandler(u16 joy, u16 changed, u16 state) {
-    // Redirect to player event handler
-    playerJoyEvent(joy, changed, state);
+void inputRecord(u16* buffer, u32 capacity) {
+    recordBuffer = buffer;
+    tapeCapacity = capacity;
+    tapeLength = 0;
+    runFrames = 0;
+    memset(&inputTapeStats, 0, sizeof(inputTapeStats));
+    mode = INPUT_RECORD;
+}
+
+u32 inputStopRecording() {
+    if (mode == INPUT_RECORD) {
+        flushRun();
+        mode = INPUT_LIVE;
+    }
+    return tapeLength;
+}
+
+void inputReplay(const u16* tape, u32 length) {
+    replayTape = tape;
+    tapeLength = length;
+    tapePos = 0;
+    runFrames = 0;
+    memset(&inputTapeStats, 0, sizeof(inputTapeStats));
+    mode = INPUT_REPLAY;
+}
+
+InputMode inputMode() {
+    return mode;
+}
+
+u32 inputTapeFrames(const u16* tape, u32 length) {
+    u32 frames = 0;
+
+    for (u32 i = 0; i < length; i++) {
+        u16 run = tape[i] >> INPUT_RUN_SHIFT;
+        if (!run && i + 1 < length) run = tape[++i];
+        frames += run;
+    }
+    return frames;
 }
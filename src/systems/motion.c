@@ -0,0 +1,9 @@
+#include <genesis.h>
+#include "systems/motion.h"
+
+u8 motionFind(const MotionCurve* curve, fix32 velocity) {
+    u8 frame = 0;
+
+    while (frame < curve->length && curve->velocity[frame] < velocity) frame++;
+    return frame;
+}
@@ -0,0 +1,86 @@
+#include <genesis.h>
+#include "systems/parallax.h"
+#include "camera.h"
+
+static const ParallaxSet* bandSet = NULL;
+
+// Band scroll positions, 8.8 fixed point
+static s32 bandPos[PARALLAX_MAX_BANDS];
+static s16 lastCameraX;
+
+// Per-line offsets handed to scroll.c for BG_B
+static s16 lineOffsets[SCROLL_LINES];
+
+/**
+ * Set every band straight from the camera. The only multiplies in the
+ * module; runs on layout changes and camera jumps.
+ */
+static void seedBands() {
+    for (u8 k = 0; k < bandSet->count; k++) {
+        bandPos[k] = -((s32) currentCameraX * bandSet->bands[k].factor);
+    }
+    lastCameraX = currentCameraX;
+}
+
+static void fillLines() {
+    s16* dst = lineOffsets;
+    s16* end = lineOffsets + SCROLL_LINES;
+
+    for (u8 k = 0; k < bandSet->count && dst < end; k++) {
+        s16 value = bandPos[k] >> 8;
+
+        for (u8 n = bandSet->bands[k].lines; n && dst < end; n--) *dst++ = value;
+    }
+
+    // Short layouts repeat the last band to the bottom
+    s16 last = dst > lineOffsets ? dst[-1] : 0;
+    while (dst < end) *dst++ = last;
+
+    scrollInvalidate();
+}
+
+void parallaxSetBands(const ParallaxSet* set) {
+    bandSet = set;
+
+    if (!set) {
+        scrollSetLineOffsets(SCROLL_LAYER_B, NULL);
+        scrollSetLayer(SCROLL_LAYER_B, PARALLAX_PLANE_FACTOR, PARALLAX_PLANE_FACTOR, PARALLAX_DRIFT_X, 0);
+        scrollSetMode(HSCROLL_PLANE, VSCROLL_PLANE);
+        return;
+    }
+
+    // Bands carry the camera part; the layer keeps drift and vertical factor
+    scrollSetLayer(SCROLL_LAYER_B, 0, PARALLAX_PLANE_FACTOR, PARALLAX_DRIFT_X, 0);
+    scrollSetLineOffsets(SCROLL_LAYER_B, lineOffsets);
+    scrollSetMode(HSCROLL_LINE, VSCROLL_PLANE);
+
+    seedBands();
+    fillLines();
+}
+
+void parallaxUpdate() {
+    if (!bandSet) return;
+
+    s16 dx = currentCameraX - lastCameraX;
+    if (!dx) return;
+
+    if (dx > PARALLAX_MAX_STEP || dx < -PARALLAX_MAX_STEP) {
+        seedBands();
+    } else {
+        // Scroll moves opposite to the camera
+        for (u8 k = 0; k < bandSet->count; k++) {
+            s16 factor = bandSet->bands[k].factor;
+            s32 pos = bandPos[k];
+
+            if (dx > 0) {
+                for (s16 i = dx; i; i--) pos -= factor;
+            } else {
+                for (s16 i = dx; i; i++) pos += factor;
+            }
+            bandPos[k] = pos;
+        }
+        lastCameraX = currentCameraX;
+    }
+
+    fillLines();
+}
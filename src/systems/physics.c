@@ -1,6 +1,7 @@
 #include <genesis.h>
 #include "systems/physics.h"
 #include "core/config.h"
+#include "systems/damping.h"
 
 void applyGravity(fix32* velY) {
     if (!velY) return;
@@ -18,20 +19,9 @@ void applyFriction(fix32* velX, fix32* velY, bool onGround) {
     if (!velX || !velY) return;
     
     // Apply appropriate friction based on ground state
-    // Manually multiply fix32 values (simplified approach)
-    if (onGround) {
-        // Ground friction = 0.85, so multiply by 0.85
-        *velX = (*velX * 85) / 100;
-    } else {
-        // Air friction = 0.95
-        *velX = (*velX * 95) / 100;
-    }
-    
-    // Stop completely if velocity is very small (prevent infinite sliding)
-    // Check if absolute value is less than a threshold
-    if (*velX < FIX32(0.1) && *velX > FIX32(-0.1)) {
-        *velX = FIX32(0);
-    }
+    // (GROUND_FRICTION / AIR_FRICTION as precomputed multiply-shift coefficients)
+    // and stop completely once velocity is negligible
+    *velX = dampToRest(*velX, onGround ? DAMPING_GROUND : DAMPING_AIR);
 }
 
 void integrateVelocity(fix32* posX, fix32* posY, fix32 velX, fix32 velY) {
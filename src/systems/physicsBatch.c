@@ -0,0 +1,88 @@
+#include <genesis.h>
+#include "systems/physicsBatch.h"
+#include "systems/damping.h"
+#include "core/config.h"
+
+// All bodies, struct-of-arrays
+PhysicsBodies physBodies;
+
+void physicsBatchInit() {
+    memset(&physBodies, 0, sizeof(physBodies));
+}
+
+u8 bodyAdd(fix32 posX, fix32 posY, fix32 maxVelX, fix32 maxVelY, u8 flags) {
+    for (u8 i = 0; i < PHYS_MAX_BODIES; i++) {
+        if (physBodies.flags[i] & BODY_ACTIVE) continue;
+
+        physBodies.posX[i] = posX;
+        physBodies.posY[i] = posY;
+        physBodies.velX[i] = FIX32(0);
+        physBodies.velY[i] = FIX32(0);
+        physBodies.maxVelX[i] = maxVelX;
+        physBodies.maxVelY[i] = maxVelY;
+        physBodies.flags[i] = flags | BODY_ACTIVE;
+
+        if (i >= physBodies.highWater) physBodies.highWater = i + 1;
+        return i;
+    }
+    return PHYS_BODY_NONE;
+}
+
+void bodyRemove(u8 body) {
+    if (body >= PHYS_MAX_BODIES) return;
+
+    physBodies.flags[body] = 0;
+
+    // Shrink the loop range when the top slots are free
+    while (physBodies.highWater > 0 &&
+           !(physBodies.flags[physBodies.highWater - 1] & BODY_ACTIVE)) {
+        physBodies.highWater--;
+    }
+}
+
+void physicsBatchUpdate() {
+    fix32* posX = physBodies.posX;
+    fix32* posY = physBodies.posY;
+    fix32* velX = physBodies.velX;
+    fix32* velY = physBodies.velY;
+    const fix32* maxVelX = physBodies.maxVelX;
+    const fix32* maxVelY = physBodies.maxVelY;
+    const u8* flags = physBodies.flags;
+    u16 count = physBodies.highWater;
+
+    for (u16 i = 0; i < count; i++) {
+        u8 f = flags[i];
+        if (!(f & BODY_ACTIVE)) continue;
+
+        fix32 vx = velX[i];
+        fix32 vy = velY[i];
+        fix32 maxX = maxVelX[i];
+        fix32 maxY = maxVelY[i];
+
+        // Gravity, capped at terminal velocity (applyGravity)
+        if (f & BODY_GRAVITY) {
+            vy += GRAVITY;
+            if (vy > MAX_FALL_SPEED) vy = MAX_FALL_SPEED;
+        }
+
+        // Ground or air friction (applyFriction)
+        if (f & BODY_FRICTION) {
+            vx = dampToRest(vx, (f & BODY_ON_GROUND) ? DAMPING_GROUND : DAMPING_AIR);
+        }
+
+        // Per-body speed limits (clampVelocity)
+        if (vx > maxX) vx = maxX;
+        else if (vx < -maxX) vx = -maxX;
+        if (vy > maxY) vy = maxY;
+        else if (vy < -maxY) vy = -maxY;
+
+        velX[i] = vx;
+        velY[i] = vy;
+
+        // Move by velocity (integrateVelocity)
+        if (f & BODY_INTEGRATE) {
+            posX[i] += vx;
+            posY[i] += vy;
+        }
+    }
+}
@@ -0,0 +1,169 @@
+#include <genesis.h>
+#include "systems/scroll.h"
+#include "systems/transfer.h"
+#include "camera.h"
+
+typedef struct {
+    s16 factorX;
+    s16 factorY;
+    s16 driftX;
+    s16 driftY;
+    s16 driftOffsetX;           // Accumulated drift (wraps with the plane)
+    s16 driftOffsetY;
+    const s16* lineOffsets;
+    const s16* columnOffsets;
+    s16 h;                      // Last computed base values
+    s16 v;
+} LayerState;
+
+static LayerState layers[SCROLL_LAYER_COUNT];
+static u16 hScrollMode;
+static u16 vScrollMode;
+static bool forceUpload;
+
+// Upload sources; the layouts match the VDP tables (A then B)
+static s16 hPlane[SCROLL_LAYER_COUNT];
+static s16 vPlane[SCROLL_LAYER_COUNT];
+static s16 hTileTable[SCROLL_LAYER_COUNT][SCROLL_TILE_ROWS];
+static s16 hLineTable[SCROLL_LINES * SCROLL_LAYER_COUNT];  // A/B interleaved per line
+static s16 vTable[SCROLL_LAYER_COUNT][SCROLL_COLUMNS];
+
+// Stands in for a missing offset table so the fill loops don't branch
+static const s16 noOffsets[SCROLL_LINES];
+
+/**
+ * Queue the horizontal scroll table for the current mode.
+ * Line mode builds the whole A/B interleaved table (base + offset, adds
+ * only) and sends it as one contiguous DMA. Tile mode only uses every 8th
+ * line, so each layer is one strided DMA instead.
+ */
+static void queueHScroll() {
+    u16 table = VDP_getHScrollTableAddress();
+
+    if (hScrollMode == HSCROLL_PLANE) {
+        for (u8 i = 0; i < SCROLL_LAYER_COUNT; i++) hPlane[i] = layers[i].h;
+        transferQueue(DMA_VRAM, hPlane, table, SCROLL_LAYER_COUNT, 2, XFER_PRIO_CRITICAL);
+        return;
+    }
+
+    if (hScrollMode == HSCROLL_LINE) {
+        const s16* offsetA = layers[SCROLL_LAYER_A].lineOffsets ? layers[SCROLL_LAYER_A].lineOffsets : noOffsets;
+        const s16* offsetB = layers[SCROLL_LAYER_B].lineOffsets ? layers[SCROLL_LAYER_B].lineOffsets : noOffsets;
+        s16 hA = layers[SCROLL_LAYER_A].h;
+        s16 hB = layers[SCROLL_LAYER_B].h;
+        s16* dst = hLineTable;
+
+        for (u16 n = SCROLL_LINES; n; n--) {
+            *dst++ = hA + *offsetA++;
+            *dst++ = hB + *offsetB++;
+        }
+        transferQueue(DMA_VRAM, hLineTable, table, SCROLL_LINES * SCROLL_LAYER_COUNT, 2, XFER_PRIO_CRITICAL);
+        return;
+    }
+
+    for (u8 i = 0; i < SCROLL_LAYER_COUNT; i++) {
+        const s16* offsets = layers[i].lineOffsets ? layers[i].lineOffsets : noOffsets;
+        s16 h = layers[i].h;
+        s16* dst = hTileTable[i];
+
+        for (u16 n = 0; n < SCROLL_TILE_ROWS; n++) dst[n] = h + offsets[n];
+        transferQueue(DMA_VRAM, dst, table + (i * 2), SCROLL_TILE_ROWS, 32, XFER_PRIO_CRITICAL);
+    }
+}
+
+static void queueVScroll() {
+    if (vScrollMode == VSCROLL_PLANE) {
+        for (u8 i = 0; i < SCROLL_LAYER_COUNT; i++) vPlane[i] = layers[i].v;
+        transferQueue(DMA_VSRAM, vPlane, 0, SCROLL_LAYER_COUNT, 2, XFER_PRIO_CRITICAL);
+        return;
+    }
+
+    for (u8 i = 0; i < SCROLL_LAYER_COUNT; i++) {
+        const s16* offsets = layers[i].columnOffsets ? layers[i].columnOffsets : noOffsets;
+        s16 v = layers[i].v;
+        s16* dst = vTable[i];
+
+        for (u16 n = 0; n < SCROLL_COLUMNS; n++) dst[n] = v + offsets[n];
+        transferQueue(DMA_VSRAM, dst, i * 2, SCROLL_COLUMNS, 4, XFER_PRIO_CRITICAL);
+    }
+}
+
+void scrollInit() {
+    memset(layers, 0, sizeof(layers));
+
+    for (u8 i = 0; i < SCROLL_LAYER_COUNT; i++) {
+        layers[i].factorX = SCROLL_FACTOR(1.0);
+        layers[i].factorY = SCROLL_FACTOR(1.0);
+    }
+
+    scrollSetMode(HSCROLL_PLANE, VSCROLL_PLANE);
+}
+
+void scrollSetMode(u16 hMode, u16 vMode) {
+    hScrollMode = hMode;
+    vScrollMode = vMode;
+    VDP_setScrollingMode(hMode, vMode);
+    forceUpload = TRUE;
+}
+
+void scrollSetLayer(ScrollLayer layer, s16 factorX, s16 factorY, s16 driftX, s16 driftY) {
+    LayerState* l = &layers[layer];
+
+    l->factorX = factorX;
+    l->factorY = factorY;
+    l->driftX = driftX;
+    l->driftY = driftY;
+    forceUpload = TRUE;
+}
+
+void scrollSetLineOffsets(ScrollLayer layer, const s16* offsets) {
+    layers[layer].lineOffsets = offsets;
+    forceUpload = TRUE;
+}
+
+void scrollSetColumnOffsets(ScrollLayer layer, const s16* offsets) {
+    layers[layer].columnOffsets = offsets;
+    forceUpload = TRUE;
+}
+
+void scrollInvalidate() {
+    forceUpload = TRUE;
+}
+
+void scrollUpdate() {
+    bool hChanged = forceUpload;
+    bool vChanged = forceUpload;
+
+    for (u8 i = 0; i < SCROLL_LAYER_COUNT; i++) {
+        LayerState* l = &layers[i];
+
+        l->driftOffsetX += l->driftX;
+        l->driftOffsetY += l->driftY;
+
+        s16 h = l->driftOffsetX - (s16) (((s32) currentCameraX * l->factorX) >> 8);
+        s16 v = l->driftOffsetY + (s16) (((s32) currentCameraY * l->factorY) >> 8);
+
+        if (h != l->h) {
+            l->h = h;
+            hChanged = TRUE;
+        }
+        if (v != l->v) {
+            l->v = v;
+            vChanged = TRUE;
+        }
+    }
+
+    // One upload per table, and only when something moved
+    if (hChanged) queueHScroll();
+    if (vChanged) queueVScroll();
+
+    forceUpload = FALSE;
+}
+
+s16 scrollGetH(ScrollLayer layer) {
+    return layers[layer].h;
+}
+
+s16 scrollGetV(ScrollLayer layer) {
+    return layers[layer].v;
+}
@@ -0,0 +1,206 @@
+#include <genesis.h>
+#include "systems/spriteAnim.h"
+#include "systems/tileAlloc.h"
+#include "systems/transfer.h"
+
+SpriteAnimStats spriteAnimStats;
+
+typedef struct {
+    const SpriteDefinition* def;    // NULL when the slot is empty
+    u8 animation;
+    u8 frame;
+    u8 refs;                        // Bindings showing this frame
+    u16 tileIndex;
+    u16 lastUse;
+} FrameSlot;
+
+static FrameSlot slots[SPRITE_ANIM_CACHE_SLOTS];
+static u16 useClock;
+
+// This frame's counters, moved to the stats by spriteAnimEndFrame()
+static u8 frameUploads;
+static u16 frameTiles;
+
+void spriteAnimInit() {
+    memset(slots, 0, sizeof(slots));
+    memset(&spriteAnimStats, 0, sizeof(spriteAnimStats));
+    useClock = 0;
+    frameUploads = 0;
+    frameTiles = 0;
+}
+
+Sprite* spriteAnimAddSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attribut) {
+    return SPR_addSpriteEx(def, x, y, attribut, SPRITE_ANIM_SPR_FLAGS);
+}
+
+static void evict(FrameSlot* slot) {
+    tileFree(TILE_POOL_SPRITE, slot->tileIndex);
+    slot->def = NULL;
+}
+
+/**
+ * Least recently used slot nobody shows (resident frames are the cache).
+ */
+static FrameSlot* findVictim() {
+    FrameSlot* victim = NULL;
+
+    for (u8 i = 0; i < SPRITE_ANIM_CACHE_SLOTS; i++) {
+        FrameSlot* s = &slots[i];
+        if (!s->def || s->refs) continue;
+        if (!victim || (u16) (useClock - s->lastUse) > (u16) (useClock - victim->lastUse)) victim = s;
+    }
+    return victim;
+}
+
+/**
+ * Find or load a frame. Returns its slot with a reference taken, or
+ * SPRITE_ANIM_NO_SLOT if there is no room for it.
+ */
+static u8 acquire(const SpriteDefinition* def, u8 animation, u8 frame) {
+    FrameSlot* empty = NULL;
+
+    useClock++;
+
+    for (u8 i = 0; i < SPRITE_ANIM_CACHE_SLOTS; i++) {
+        FrameSlot* s = &slots[i];
+
+        if (s->def == def && s->animation == animation && s->frame == frame) {
+            s->refs++;
+            s->lastUse = useClock;
+            spriteAnimStats.shared++;
+            return i;
+        }
+        if (!s->def && !empty) empty = s;
+    }
+
+    if (!empty) {
+        empty = findVictim();
+        if (!empty) return SPRITE_ANIM_NO_SLOT;
+        evict(empty);
+    }
+
+    const TileSet* tileset = def->animations[animation]->frames[frame]->tileset;
+    u16 index = tileAlloc(TILE_POOL_SPRITE, tileset->numTile);
+
+    // Make room by dropping frames nobody shows, oldest first
+    while (index == TILE_ALLOC_NONE) {
+        FrameSlot* victim = findVictim();
+        if (!victim) return SPRITE_ANIM_NO_SLOT;
+        evict(victim);
+        index = tileAlloc(TILE_POOL_SPRITE, tileset->numTile);
+    }
+
+    // Uncompressed frames go straight from ROM through the transfer queue,
+    // critical so they are never deferred past the vblank that switches
+    // the sprite's tile index
+    if (tileset->compression == COMPRESSION_NONE) {
+        if (!transferTiles(tileset->tiles, index, tileset->numTile, XFER_PRIO_CRITICAL)) {
+            tileFree(TILE_POOL_SPRITE, index);
+            return SPRITE_ANIM_NO_SLOT;
+        }
+    } else {
+        VDP_loadTileSet(tileset, index, DMA);
+    }
+
+    empty->def = def;
+    empty->animation = animation;
+    empty->frame = frame;
+    empty->refs = 1;
+    empty->tileIndex = index;
+    empty->lastUse = useClock;
+
+    frameUploads++;
+    frameTiles += tileset->numTile;
+    spriteAnimStats.uploads++;
+    spriteAnimStats.uploadTiles += tileset->numTile;
+
+    return empty - slots;
+}
+
+static bool showing(const SpriteAnim* binding, u8 frame) {
+    if (binding->slot == SPRITE_ANIM_NO_SLOT) return FALSE;
+
+    const FrameSlot* s = &slots[binding->slot];
+    return s->frame == frame && s->animation == binding->animation;
+}
+
+static void release(SpriteAnim* binding) {
+    if (binding->slot == SPRITE_ANIM_NO_SLOT) return;
+
+    // Stays resident for the next binding (or loop) that wants it
+    slots[binding->slot].refs--;
+    binding->slot = SPRITE_ANIM_NO_SLOT;
+}
+
+/**
+ * Point the sprite at a frame. Only called when the frame differs from the
+ * one shown; the old frame is normally released after the new one is in.
+ */
+static void showFrame(SpriteAnim* binding, u8 frame) {
+    const SpriteDefinition* def = binding->sprite->definition;
+    u8 slot = acquire(def, binding->animation, frame);
+
+    spriteAnimStats.changes++;
+
+    // Pool too tight to hold both: give up the old frame's tiles and retry
+    // (queued tiles and the tile index land in the same vblank)
+    if (slot == SPRITE_ANIM_NO_SLOT && binding->slot != SPRITE_ANIM_NO_SLOT) {
+        release(binding);
+        slot = acquire(def, binding->animation, frame);
+    }
+    if (slot == SPRITE_ANIM_NO_SLOT) {
+        spriteAnimStats.failed++;
+        return;
+    }
+
+    release(binding);
+    binding->slot = slot;
+
+    SPR_setVRAMTileIndex(binding->sprite, slots[slot].tileIndex);
+    SPR_setAnimAndFrame(binding->sprite, binding->animation, frame);
+}
+
+bool spriteAnimBind(SpriteAnim* binding, Sprite* sprite, u8 animation, const AnimSeq* seq, u8 owner) {
+    binding->sprite = sprite;
+    binding->slot = SPRITE_ANIM_NO_SLOT;
+    binding->animation = animation;
+    binding->anim = animAdd(seq, owner);
+    if (binding->anim == ANIM_SLOT_NONE) return FALSE;
+
+    showFrame(binding, animFrame(binding->anim));
+    return TRUE;
+}
+
+void spriteAnimPlay(SpriteAnim* binding, u8 animation, const AnimSeq* seq) {
+    if (binding->anim == ANIM_SLOT_NONE) return;
+
+    binding->animation = animation;
+    animPlay(binding->anim, seq);
+    spriteAnimSync(binding);
+}
+
+void spriteAnimSync(SpriteAnim* binding) {
+    // Never bound (no animBatch slot was free)
+    if (binding->anim == ANIM_SLOT_NONE) return;
+
+    u8 frame = animFrame(binding->anim);
+
+    // Dirty check: same frame, nothing to send
+    if (showing(binding, frame)) return;
+
+    showFrame(binding, frame);
+}
+
+void spriteAnimUnbind(SpriteAnim* binding) {
+    release(binding);
+    animRemove(binding->anim);
+    binding->anim = ANIM_SLOT_NONE;
+    binding->sprite = NULL;
+}
+
+void spriteAnimEndFrame() {
+    spriteAnimStats.frameUploads = frameUploads;
+    spriteAnimStats.frameTiles = frameTiles;
+    frameUploads = 0;
+    frameTiles = 0;
+}
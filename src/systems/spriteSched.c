@@ -0,0 +1,171 @@
+#include <genesis.h>
+#include "systems/spriteSched.h"
+
+SpriteSchedStats spriteSchedStats;
+
+typedef struct {
+    Sprite* sprite;
+    u8 firstBand;
+    u8 lastBand;
+    u8 width;           // Pixels on a scanline
+    u8 perLine;         // Hardware sprites on a scanline
+    u8 hwCount;         // Hardware sprites in total
+    bool pinned;
+} SchedEntry;
+
+static SchedEntry entries[SPR_SCHED_MAX];
+static u8 entryCount;
+static u8 pinnedCount;
+
+// Ranked submission indices: pinned first, then the rotated rest
+static u8 order[SPR_SCHED_MAX];
+static u16 rotation;
+
+static u8 bandSprites[SPR_SCHED_BANDS];
+static u16 bandDots[SPR_SCHED_BANDS];
+
+void spriteSchedInit() {
+    memset(&spriteSchedStats, 0, sizeof(spriteSchedStats));
+    entryCount = 0;
+    pinnedCount = 0;
+    rotation = 0;
+}
+
+void spriteSchedSubmit(Sprite* sprite, s16 x, s16 y, bool pinned) {
+    const SpriteDefinition* def = sprite->definition;
+    s16 w = def->w;
+    s16 h = def->h;
+
+    // Off-screen sprites take no scanline budget
+    if (x + w <= 0 || x >= SCREEN_WIDTH || y + h <= 0 || y >= SCREEN_HEIGHT) return;
+    if (entryCount >= SPR_SCHED_MAX) return;
+
+    SchedEntry* e = &entries[entryCount++];
+    s16 top = max(y, 0);
+    s16 bottom = min(y + h - 1, SCREEN_HEIGHT - 1);
+
+    e->sprite = sprite;
+    e->firstBand = top >> SPR_SCHED_BAND_SHIFT;
+    e->lastBand = bottom >> SPR_SCHED_BAND_SHIFT;
+    e->width = w;
+    e->perLine = (w + SPR_SCHED_HW_WIDTH - 1) / SPR_SCHED_HW_WIDTH;
+    e->hwCount = e->perLine * ((h + SPR_SCHED_HW_WIDTH - 1) / SPR_SCHED_HW_WIDTH);
+    e->pinned = pinned;
+    if (pinned) pinnedCount++;
+}
+
+/**
+ * Rank pinned sprites first, then the others starting at the rotation
+ * offset, and move the SGDK depths to match (SPR_update re-links by depth).
+ */
+static u8 applyRotation() {
+    u8 rotatedCount = entryCount - pinnedCount;
+    u8 start = rotatedCount ? rotation % rotatedCount : 0;
+    u8 pinnedRank = 0;
+    u8 changes = 0;
+
+    for (u8 i = 0, rank = 0; i < entryCount; i++) {
+        SchedEntry* e = &entries[i];
+        s16 depth;
+
+        if (e->pinned) {
+            order[pinnedRank] = i;
+            depth = SPR_SCHED_DEPTH_PINNED + pinnedRank++;
+        } else {
+            u8 slot = rank + (rotatedCount - start);
+            if (slot >= rotatedCount) slot -= rotatedCount;
+            order[pinnedCount + slot] = i;
+            depth = SPR_SCHED_DEPTH_BASE + slot;
+            rank++;
+        }
+
+        if (e->sprite->depth != depth) {
+            SPR_setDepth(e->sprite, depth);
+            changes++;
+        }
+    }
+    return changes;
+}
+
+/**
+ * Replay the hardware limits in link order and count the sprites that
+ * lose at least one band.
+ */
+static u8 countDropped() {
+    u8 dropped = 0;
+    u8 linked = 0;
+
+    memset(bandSprites, 0, sizeof(bandSprites));
+    memset(bandDots, 0, sizeof(bandDots));
+
+    for (u8 r = 0; r < entryCount; r++) {
+        SchedEntry* e = &entries[order[r]];
+        bool lost = FALSE;
+
+        if (linked + e->hwCount > SPR_SCHED_HW_MAX) {
+            dropped++;
+            continue;
+        }
+        linked += e->hwCount;
+
+        for (u8 b = e->firstBand; b <= e->lastBand; b++) {
+            if (bandSprites[b] + e->perLine > SPR_SCHED_LINE_MAX || bandDots[b] + e->width > SPR_SCHED_DOTS_MAX) {
+                lost = TRUE;
+            } else {
+                bandSprites[b] += e->perLine;
+                bandDots[b] += e->width;
+            }
+        }
+        if (lost) dropped++;
+    }
+    return dropped;
+}
+
+void spriteSchedUpdate() {
+    u16 hwSprites = 0;
+    u8 overBands = 0;
+    u8 worst = 0;
+
+    memset(bandSprites, 0, sizeof(bandSprites));
+    memset(bandDots, 0, sizeof(bandDots));
+
+    for (u8 i = 0; i < entryCount; i++) {
+        SchedEntry* e = &entries[i];
+
+        hwSprites += e->hwCount;
+        for (u8 b = e->firstBand; b <= e->lastBand; b++) {
+            bandSprites[b] += e->perLine;
+            bandDots[b] += e->width;
+        }
+    }
+
+    for (u8 b = 0; b < SPR_SCHED_BANDS; b++) {
+        if (bandSprites[b] > SPR_SCHED_LINE_MAX || bandDots[b] > SPR_SCHED_DOTS_MAX) {
+            u8 over = bandSprites[b] - min(bandSprites[b], SPR_SCHED_LINE_MAX);
+            overBands++;
+            if (over > worst) worst = over;
+        }
+    }
+    if (hwSprites > SPR_SCHED_HW_MAX && hwSprites - SPR_SCHED_HW_MAX > worst) worst = hwSprites - SPR_SCHED_HW_MAX;
+
+    spriteSchedStats.submitted = entryCount;
+    spriteSchedStats.hwSprites = min(hwSprites, 0xFF);
+    spriteSchedStats.overBands = overBands;
+    spriteSchedStats.dropped = 0;
+    spriteSchedStats.rotated = 0;
+
+    // Within budget: keep the link order as it is (no re-sort)
+    if (overBands || hwSprites > SPR_SCHED_HW_MAX) {
+        // Step by the overflow so each frame hides a different group
+        rotation += worst ? worst : 1;
+
+        spriteSchedStats.rotated = applyRotation();
+        spriteSchedStats.dropped = countDropped();
+        spriteSchedStats.overflowFrames++;
+        spriteSchedStats.droppedTotal += spriteSchedStats.dropped;
+        spriteSchedStats.rotatedTotal += spriteSchedStats.rotated;
+    }
+
+    entryCount = 0;
+    pinnedCount = 0;
+}
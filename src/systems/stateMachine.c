@@ -0,0 +1,21 @@
+#include <genesis.h>
+#include "systems/stateMachine.h"
+
+bool stateChange(const StateDef* table, u8* current, u8 next, void* owner) {
+    if (!stateAllows(table, *current, next)) return FALSE;
+
+    stateForce(table, current, next, owner);
+    return TRUE;
+}
+
+void stateForce(const StateDef* table, u8* current, u8 next, void* owner) {
+    StateFunc* leave = table[*current].exit;
+
+    if (leave) leave(owner);
+    *current = next;
+    if (table[next].enter) table[next].enter(owner);
+}
+
+void stateUpdate(const StateDef* table, u8 current, void* owner) {
+    if (table[current].update) table[current].update(owner);
+}
@@ -0,0 +1,138 @@
+#include <genesis.h>
+#include "systems/tileAlloc.h"
+
+typedef struct {
+    u16 start;
+    u16 size;
+    bool used;
+} TileBlock;
+
+typedef struct {
+    u16 base;
+    u16 size;
+    u8 count;
+    TileBlock blocks[TILE_ALLOC_MAX_BLOCKS];
+} TilePoolState;
+
+static TilePoolState pools[TILE_POOL_COUNT];
+
+static void resetPool(TilePoolState* p) {
+    p->count = 1;
+    p->blocks[0].start = p->base;
+    p->blocks[0].size = p->size;
+    p->blocks[0].used = FALSE;
+}
+
+static void removeBlock(TilePoolState* p, u8 i) {
+    p->count--;
+    for (u8 j = i; j < p->count; j++) p->blocks[j] = p->blocks[j + 1];
+}
+
+void tileAllocInit() {
+    u16 base = TILE_USER_INDEX;
+    u16 end = TILE_USER_MAX_INDEX + 1 - TILE_POOL_SPR_ENGINE_SIZE;
+
+    pools[TILE_POOL_SPRITE].base = base;
+    pools[TILE_POOL_SPRITE].size = TILE_POOL_SPRITE_SIZE;
+    base += TILE_POOL_SPRITE_SIZE;
+
+    pools[TILE_POOL_ZONE].base = base;
+    pools[TILE_POOL_ZONE].size = end - base;
+
+    for (u8 i = 0; i < TILE_POOL_COUNT; i++) resetPool(&pools[i]);
+}
+
+u16 tileAlloc(TilePool pool, u16 count) {
+    TilePoolState* p = &pools[pool];
+
+    if (!count) return TILE_ALLOC_NONE;
+
+    for (u8 i = 0; i < p->count; i++) {
+        TileBlock* b = &p->blocks[i];
+
+        if (b->used || b->size < count) continue;
+
+        if (b->size > count) {
+            // Split: the remainder stays free right after the new block
+            if (p->count >= TILE_ALLOC_MAX_BLOCKS) return TILE_ALLOC_NONE;
+
+            for (u8 j = p->count; j > i + 1; j--) p->blocks[j] = p->blocks[j - 1];
+            p->blocks[i + 1].start = b->start + count;
+            p->blocks[i + 1].size = b->size - count;
+            p->blocks[i + 1].used = FALSE;
+            p->count++;
+            b->size = count;
+        }
+
+        b->used = TRUE;
+        return b->start;
+    }
+
+    return TILE_ALLOC_NONE;
+}
+
+void tileFree(TilePool pool, u16 index) {
+    TilePoolState* p = &pools[pool];
+
+    if (index == TILE_ALLOC_NONE) return;
+
+    for (u8 i = 0; i < p->count; i++) {
+        TileBlock* b = &p->blocks[i];
+
+        if (b->start != index) continue;
+        if (!b->used) return;
+
+        b->used = FALSE;
+
+        // Coalesce with the next block, then with the previous one
+        if (i + 1 < p->count && !p->blocks[i + 1].used) {
+            b->size += p->blocks[i + 1].size;
+            removeBlock(p, i + 1);
+        }
+        if (i > 0 && !p->blocks[i - 1].used) {
+            p->blocks[i - 1].size += b->size;
+            removeBlock(p, i);
+        }
+        return;
+    }
+}
+
+void tileAllocReset(TilePool pool) {
+    resetPool(&pools[pool]);
+}
+
+void tileAllocGetStats(TilePool pool, TileAllocStats* stats) {
+    TilePoolState* p = &pools[pool];
+    u16 freeTiles = 0;
+
+    stats->base = p->base;
+    stats->size = p->size;
+    stats->used = 0;
+    stats->largestFree = 0;
+    stats->blocks = p->count;
+
+    for (u8 i = 0; i < p->count; i++) {
+        TileBlock* b = &p->blocks[i];
+
+        if (b->used) {
+            stats->used += b->size;
+        } else {
+            freeTiles += b->size;
+            if (b->size > stats->largestFree) stats->largestFree = b->size;
+        }
+    }
+
+    stats->fragmentation = freeTiles ? 100 - ((u32) stats->largestFree * 100) / freeTiles : 0;
+}
+
+void tileAllocDump() {
+    static const char* poolNames[TILE_POOL_COUNT] = { "ZONE  ", "SPRITE" };
+    TileAllocStats stats;
+
+    for (u8 i = 0; i < TILE_POOL_COUNT; i++) {
+        tileAllocGetStats(i, &stats);
+        kprintf("VRAM %s @%4u: %4u/%4u used, largest free %4u, %2u blocks, frag %3u%%",
+                poolNames[i], stats.base, stats.used, stats.size,
+                stats.largestFree, stats.blocks, stats.fragmentation);
+    }
+}
@@ -0,0 +1,78 @@
+#include <genesis.h>
+#include "systems/tileCollision.h"
+
+// Collision layer of the current zone (set by loadZone)
+const CollisionMap* collisionMap = NULL;
+
+void tileCollisionSetMap(const CollisionMap* map) {
+    collisionMap = map;
+}
+
+bool tileResolveX(fix32* posX, fix32 posY, fix32* velX, const CollisionBox* box) {
+    if (*velX == FIX32(0)) return FALSE;
+
+    s16 left = F32_toInt(*posX) + box->x;
+    s16 top = F32_toInt(posY) + box->y;
+    s16 newLeft;
+
+    if (*velX > FIX32(0)) {
+        // Leading edge is the right side
+        if (!tileWallAhead(left, top, box->width - 1, box->height, TRUE)) return FALSE;
+        newLeft = (((left + box->width - 1) >> COLL_TILE_SHIFT) << COLL_TILE_SHIFT) - box->width;
+    } else {
+        if (!tileWallAhead(left + 1, top, box->width, box->height, FALSE)) return FALSE;
+        newLeft = ((left >> COLL_TILE_SHIFT) + 1) << COLL_TILE_SHIFT;
+    }
+
+    *posX = FIX32(newLeft - box->x);
+    *velX = FIX32(0);
+    return TRUE;
+}
+
+bool tileResolveY(fix32* posY, fix32 prevPosY, fix32 posX, fix32* velY, const CollisionBox* box) {
+    s16 left = F32_toInt(posX) + box->x;
+    s16 top = F32_toInt(*posY) + box->y;
+    s16 right = left + box->width - 1;
+
+    if (*velY > FIX32(0)) {
+        // Falling: look for support in the row the feet ended up in
+        s16 bottom = top + box->height - 1;
+        s16 rowTop = (bottom >> COLL_TILE_SHIFT) << COLL_TILE_SHIFT;
+        s16 prevBottom = F32_toInt(prevPosY) + box->y + box->height - 1;
+        bool hit = FALSE;
+
+        for (s16 px = left; ; px += TILE_DIMENSION) {
+            if (px > right) px = right;
+
+            u16 attr = tileAttrAt(px, bottom);
+            // Platforms only catch boxes that were above them last frame
+            if (attr == COLL_SOLID || (attr == COLL_PLATFORM && prevBottom < rowTop)) {
+                hit = TRUE;
+                break;
+            }
+            if (px == right) break;
+        }
+
+        if (!hit) return FALSE;
+
+        *posY = FIX32(rowTop - box->height - box->y);
+        *velY = FIX32(0);
+        return TRUE;
+    }
+
+    if (*velY < FIX32(0)) {
+        // Rising: bump the head on solid cells only
+        for (s16 px = left; ; px += TILE_DIMENSION) {
+            if (px > right) px = right;
+
+            if (tileSolidAt(px, top)) {
+                *posY = FIX32((((top >> COLL_TILE_SHIFT) + 1) << COLL_TILE_SHIFT) - box->y);
+                *velY = FIX32(0);
+                return FALSE;
+            }
+            if (px == right) break;
+        }
+    }
+
+    return FALSE;
+}
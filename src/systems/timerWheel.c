@@ -0,0 +1,182 @@
+#include <genesis.h>
+#include "systems/timerWheel.h"
+
+#define WHEEL_MASK (TIMER_WHEEL_SLOTS - 1)
+
+// Handle layout: generation in the high byte, slot index in the low byte
+#define TIMER_HANDLE(index, generation) ((TimerHandle) (((generation) << 8) | (index)))
+#define TIMER_HANDLE_INDEX(handle) ((handle) & 0xFF)
+#define TIMER_HANDLE_GENERATION(handle) ((handle) >> 8)
+
+typedef struct {
+    u16 due;                // Frame it fires on (wraps with the frame counter)
+    u8 generation;          // Bumped on every start in this slot
+    bool pending;
+    u8 next;                // Bucket list while pending, free list otherwise
+    u8 prev;
+    u16 arg;
+    TimerCallback* callback;
+    bool* flag;             // Set instead of calling when not NULL
+} Timer;
+
+TimerStats timerStats;
+
+static Timer timers[TIMER_MAX];
+static u8 buckets[TIMER_WHEEL_SLOTS];
+static u8 freeHead;
+
+// Frames advanced by timerUpdate()
+static u16 now;
+
+void timerInit() {
+    memset(timers, 0, sizeof(timers));
+    memset(&timerStats, 0, sizeof(timerStats));
+
+    for (u8 i = 0; i < TIMER_MAX; i++) {
+        timers[i].next = (i + 1 < TIMER_MAX) ? i + 1 : TIMER_SLOT_NONE;
+    }
+    for (u8 i = 0; i < TIMER_WHEEL_SLOTS; i++) buckets[i] = TIMER_SLOT_NONE;
+    freeHead = 0;
+    now = 0;
+}
+
+static void unlinkTimer(u8 index) {
+    Timer* t = &timers[index];
+
+    if (t->prev != TIMER_SLOT_NONE) timers[t->prev].next = t->next;
+    else buckets[t->due & WHEEL_MASK] = t->next;
+    if (t->next != TIMER_SLOT_NONE) timers[t->next].prev = t->prev;
+}
+
+static void releaseTimer(u8 index) {
+    Timer* t = &timers[index];
+
+    // Keep the generation so old handles stay stale
+    t->pending = FALSE;
+    t->next = freeHead;
+    freeHead = index;
+    timerStats.active--;
+}
+
+static TimerHandle start(u16 frames, TimerCallback* callback, bool* flag, u16 arg) {
+    if (freeHead == TIMER_SLOT_NONE) {
+        timerStats.failed++;
+        return TIMER_NONE;
+    }
+
+    u8 index = freeHead;
+    Timer* t = &timers[index];
+
+    freeHead = t->next;
+
+    // Generation 0 is reserved so TIMER_NONE can never match a live timer
+    t->generation++;
+    if (!t->generation) t->generation = 1;
+
+    t->due = now + (frames ? frames : 1);
+    t->pending = TRUE;
+    t->arg = arg;
+    t->callback = callback;
+    t->flag = flag;
+
+    // Push onto the due frame's bucket
+    u8 bucket = t->due & WHEEL_MASK;
+    t->prev = TIMER_SLOT_NONE;
+    t->next = buckets[bucket];
+    if (t->next != TIMER_SLOT_NONE) timers[t->next].prev = index;
+    buckets[bucket] = index;
+
+    if (++timerStats.active > timerStats.peak) timerStats.peak = timerStats.active;
+
+    return TIMER_HANDLE(index, t->generation);
+}
+
+TimerHandle timerStart(u16 frames, TimerCallback* callback, u16 arg) {
+    return start(frames, callback, NULL, arg);
+}
+
+TimerHandle timerStartFlag(u16 frames, bool* flag) {
+    return start(frames, NULL, flag, 0);
+}
+
+/**
+ * Pending timer behind a handle, or NULL.
+ */
+static Timer* lookup(TimerHandle handle) {
+    u8 index = TIMER_HANDLE_INDEX(handle);
+
+    if (index >= TIMER_MAX) return NULL;
+
+    Timer* t = &timers[index];
+    if (!t->pending || t->generation != TIMER_HANDLE_GENERATION(handle)) return NULL;
+
+    return t;
+}
+
+void timerCancel(TimerHandle handle) {
+    Timer* t = lookup(handle);
+    if (!t) return;
+
+    u8 index = TIMER_HANDLE_INDEX(handle);
+
+    timerStats.cancelled++;
+
+    // Due now: timerUpdate() has it in its fired list and will skip it
+    if (t->due == now) {
+        t->pending = FALSE;
+        return;
+    }
+
+    unlinkTimer(index);
+    releaseTimer(index);
+}
+
+u16 timerRemaining(TimerHandle handle) {
+    Timer* t = lookup(handle);
+
+    return t ? (u16) (t->due - now) : 0;
+}
+
+void timerUpdate() {
+    u8 fired = TIMER_SLOT_NONE;
+    u8 visited = 0;
+
+    now++;
+
+    // Take the due timers out of this frame's bucket first, so callbacks
+    // can start timers (even into this bucket) while they run
+    u8 i = buckets[now & WHEEL_MASK];
+    while (i != TIMER_SLOT_NONE) {
+        Timer* t = &timers[i];
+        u8 next = t->next;
+
+        visited++;
+        if (t->due == now) {
+            unlinkTimer(i);
+            t->next = fired;
+            fired = i;
+        }
+        i = next;
+    }
+
+    timerStats.visited = visited;
+    timerStats.visitedTotal += visited;
+
+    while (fired != TIMER_SLOT_NONE) {
+        Timer* t = &timers[fired];
+        u8 next = t->next;
+        TimerCallback* callback = t->callback;
+        bool* flag = t->flag;
+        u16 arg = t->arg;
+        bool cancelled = !t->pending;
+
+        // Free before firing: the callback sees the timer as done
+        releaseTimer(fired);
+        fired = next;
+        if (cancelled) continue;
+
+        timerStats.fired++;
+        if (flag) *flag = TRUE;
+        else callback(arg);
+    }
+}
@@ -0,0 +1,170 @@
+#include <genesis.h>
+#include "systems/transfer.h"
+
+typedef struct {
+    const u8* from;
+    u16 to;
+    u16 len;
+    u16 step;
+    u8 location;
+    u8 priority;
+} Transfer;
+
+TransferStats transferStats;
+
+// FIFO order within a priority is kept by insertion order
+static Transfer queue[TRANSFER_MAX_ENTRIES];
+static u16 queueCount;
+
+void transferInit() {
+    memset(&transferStats, 0, sizeof(transferStats));
+    queueCount = 0;
+}
+
+/**
+ * Drop queued entries marked empty (len 0), keeping order.
+ */
+static void compactQueue() {
+    u16 kept = 0;
+
+    for (u16 i = 0; i < queueCount; i++) {
+        if (queue[i].len) queue[kept++] = queue[i];
+    }
+    queueCount = kept;
+}
+
+/**
+ * Trim an older entry with the same stride to what a newer transfer over
+ * [to, end) doesn't cover; it is dropped if nothing is left. Returns FALSE
+ * if the new range lies strictly inside it, which would need two entries.
+ */
+static bool trimOverlap(Transfer* t, u32 to, u32 end) {
+    u32 tEnd = t->to + ((u32) t->len * t->step);
+
+    if (to > t->to && end < tEnd) return FALSE;
+
+    if (end >= tEnd) {
+        // Covered from the start, or only the tail is
+        t->len = (to > t->to) ? (to - t->to) / t->step : 0;
+    } else {
+        u16 skip = (end - t->to) / t->step;
+
+        t->from += skip * 2;
+        t->to += skip * t->step;
+        t->len -= skip;
+    }
+    return TRUE;
+}
+
+bool transferQueue(u8 location, const void* from, u16 to, u16 len, u16 step, TransferPriority priority) {
+    u32 end = to + ((u32) len * step);
+
+    if (!len) return TRUE;
+
+    // Older data to the same addresses must not land on top of this. Entries
+    // on another stride (a map column crossing a row) only share a few cells
+    // and flush in queue order, so later writes still win within a priority.
+    for (u16 i = 0; i < queueCount; i++) {
+        Transfer* t = &queue[i];
+
+        if (t->location != location || t->step != step) continue;
+        if ((u16) (t->to - to) % step) continue;
+        if (t->to >= end || t->to + ((u32) t->len * t->step) <= to) continue;
+
+        if (trimOverlap(t, to, end)) continue;
+
+        if (priority == XFER_PRIO_CRITICAL) {
+            // Send the surrounding old entry now, ahead of this one
+            DMA_queueDma(t->location, (void*) t->from, t->to, t->len, t->step);
+            transferStats.sentBytes += t->len * 2;
+            t->len = 0;
+        } else if (t->priority > priority) {
+            // Queue behind it at its priority so it can't flush after this
+            priority = t->priority;
+        }
+    }
+    compactQueue();
+
+    if (queueCount >= TRANSFER_MAX_ENTRIES) {
+        if (priority != XFER_PRIO_CRITICAL) return FALSE;
+
+        DMA_queueDma(location, (void*) from, to, len, step);
+        transferStats.sentBytes += len * 2;
+        return TRUE;
+    }
+
+    Transfer* t = &queue[queueCount++];
+    t->from = from;
+    t->to = to;
+    t->len = len;
+    t->step = step;
+    t->location = location;
+    t->priority = priority;
+    return TRUE;
+}
+
+bool transferTiles(const u32* data, u16 index, u16 num, TransferPriority priority) {
+    return transferQueue(DMA_VRAM, data, index * TILE_SIZE, num * (TILE_SIZE / 2), 2, priority);
+}
+
+bool transferPalette(u16 numPal, const u16* pal) {
+    return transferQueue(DMA_CRAM, pal, numPal * 32, 16, 2, XFER_PRIO_HIGH);
+}
+
+void transferCancel(TransferPriority priority) {
+    for (u16 i = 0; i < queueCount; i++) {
+        if (queue[i].priority == priority) queue[i].len = 0;
+    }
+    compactQueue();
+}
+
+u16 transferPending(TransferPriority priority) {
+    u16 count = 0;
+
+    for (u16 i = 0; i < queueCount; i++) {
+        if (queue[i].priority <= priority) count++;
+    }
+    return count;
+}
+
+void transferFlush() {
+    s16 budget = (SYS_isPAL() ? TRANSFER_BUDGET_PAL : TRANSFER_BUDGET_NTSC) - DMA_getQueueTransferSize();
+    u16 sent = 0;
+
+    for (u8 prio = XFER_PRIO_CRITICAL; prio < XFER_PRIO_COUNT; prio++) {
+        for (u16 i = 0; i < queueCount; i++) {
+            Transfer* t = &queue[i];
+
+            if (t->priority != prio) continue;
+
+            u16 len = t->len;
+
+            if (prio != XFER_PRIO_CRITICAL) {
+                // Out of budget: this and later entries of the level wait
+                if (budget < 2) break;
+                if (len * 2 > (u16) budget) len = budget / 2;
+            }
+
+            DMA_queueDma(t->location, (void*) t->from, t->to, len, t->step);
+            budget -= len * 2;
+            sent += len * 2;
+
+            // Split: keep the tail queued for the next frame (a newer
+            // transfer over it trims it in transferQueue)
+            t->from += len * 2;
+            t->to += len * t->step;
+            t->len -= len;
+            if (t->len) break;
+        }
+
+        if (prio == XFER_PRIO_CRITICAL && budget < 0) transferStats.overBudget++;
+    }
+
+    compactQueue();
+
+    transferStats.carried += queueCount;
+    transferStats.pending = queueCount;
+    transferStats.sentBytes += sent;
+    transferStats.lastBytes = DMA_getQueueTransferSize();
+    if (transferStats.lastBytes > transferStats.peakBytes) transferStats.peakBytes = transferStats.lastBytes;
+}
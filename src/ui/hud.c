@@ -2,11 +2,41 @@
 #include "ui/hud.h"
 #include "entities/player.h"
 #include "world/zone.h"
+#include "systems/transfer.h"
+
+// HP/SP layout: "HP:123/456" at (1,1), "SP:123/456" at (1,2)
+#define HUD_STAT_X 1
+#define HUD_HEALTH_Y 1
+#define HUD_STAMINA_Y 2
+#define HUD_ZONE_X 1
+#define HUD_ZONE_Y 27
+
+// Digit cells of one stat line: current value at +3, max value at +7
+#define HUD_CUR_OFFSET 3
+#define HUD_MAX_OFFSET 7
+#define HUD_DIGITS 3
+#define HUD_VALUE_MAX 999
+#define HUD_NO_VALUE 0xFFFF
+
+/**
+ * One 3-digit number on the text plane. Cells hold ready-made tilemap
+ * entries; only the span of digits that changed is queued for vblank.
+ */
+typedef struct {
+    u16 x;
+    u16 y;
+    u16 value;
+    u16 cells[HUD_DIGITS];
+    u8 dirtyFirst;
+    u8 dirtyLast;
+} HudNumber;
 
 static bool hudVisible = TRUE;
-static char healthText[16];
-static char staminaText[16];
-static char zoneText[32];
+
+// Tilemap entries for '0'..'9' in the system font
+static u16 digitTiles[10];
+
+static HudNumber numbers[4];
 
 // Zone names
 static const char* zoneNames[] = {
@@ -19,44 +49,131 @@ static const char* zoneNames[] = {
     "RESERVED"
 };
 
+static void initNumber(HudNumber* n, u16 x, u16 y) {
+    n->x = x;
+    n->y = y;
+    n->value = HUD_NO_VALUE;
+    n->dirtyFirst = HUD_DIGITS;
+}
+
+/**
+ * Split a value into digit cells and mark the ones that changed.
+ */
+static void setNumber(HudNumber* n, u16 value) {
+    if (value > HUD_VALUE_MAX) value = HUD_VALUE_MAX;
+    if (value == n->value) return;
+
+    u8 digits[HUD_DIGITS];
+    u8 hundreds = 0;
+    u8 tens = 0;
+
+    while (value >= 100) { value -= 100; hundreds++; }
+    while (value >= 10) { value -= 10; tens++; }
+    digits[0] = hundreds;
+    digits[1] = tens;
+    digits[2] = value;
+
+    n->value = (hundreds * 100) + (tens * 10) + value;
+
+    for (u8 i = 0; i < HUD_DIGITS; i++) {
+        u16 cell = digitTiles[digits[i]];
+
+        if (cell == n->cells[i]) continue;
+
+        n->cells[i] = cell;
+        if (n->dirtyFirst == HUD_DIGITS) n->dirtyFirst = i;
+        n->dirtyLast = i;
+    }
+}
+
+static void flushNumber(HudNumber* n) {
+    if (n->dirtyFirst == HUD_DIGITS) return;
+
+    u16 first = n->dirtyFirst;
+
+    transferQueue(DMA_VRAM, &n->cells[first],
+                  VDP_getPlaneAddress(VDP_getTextPlane(), n->x + first, n->y),
+                  n->dirtyLast - first + 1, 2, XFER_PRIO_NORMAL);
+    n->dirtyFirst = HUD_DIGITS;
+}
+
+/**
+ * Draw the fixed parts of the HUD and force every number to redraw.
+ */
+static void drawStatic() {
+    VDP_drawText("HP:   /", HUD_STAT_X, HUD_HEALTH_Y);
+    VDP_drawText("SP:   /", HUD_STAT_X, HUD_STAMINA_Y);
+
+    initNumber(&numbers[0], HUD_STAT_X + HUD_CUR_OFFSET, HUD_HEALTH_Y);
+    initNumber(&numbers[1], HUD_STAT_X + HUD_MAX_OFFSET, HUD_HEALTH_Y);
+    initNumber(&numbers[2], HUD_STAT_X + HUD_CUR_OFFSET, HUD_STAMINA_Y);
+    initNumber(&numbers[3], HUD_STAT_X + HUD_MAX_OFFSET, HUD_STAMINA_Y);
+
+    for (u8 i = 0; i < 4; i++) {
+        memset(numbers[i].cells, 0, sizeof(numbers[i].cells));
+    }
+
+    hudShowZone(getCurrentZone());
+}
+
 void hudInit() {
     hudVisible = TRUE;
-    
+
     // Clear text plane
     VDP_clearTextArea(0, 0, 40, 28);
+
+    u16 attr = TILE_ATTR(VDP_getTextPalette(), VDP_getTextPriority(), FALSE, FALSE);
+    for (u8 d = 0; d < 10; d++) {
+        digitTiles[d] = attr + TILE_FONT_INDEX + ('0' - 32) + d;
+    }
+
+    drawStatic();
 }
 
 void hudUpdate() {
     if (!hudVisible) return;
-    
-    // Update text strings
-    sprintf(healthText, "HP:%03d/%03d", player.health, player.maxHealth);
-    sprintf(staminaText, "SP:%03d/%03d", player.stamina, player.maxStamina);
-    sprintf(zoneText, "ZONE:%s", zoneNames[getCurrentZone()]);
+
+    // Only digits that differ from what is on screen get marked
+    setNumber(&numbers[0], player.health);
+    setNumber(&numbers[1], player.maxHealth);
+    setNumber(&numbers[2], player.stamina);
+    setNumber(&numbers[3], player.maxStamina);
 }
 
 void hudRender() {
     if (!hudVisible) return;
-    
-    // Draw HUD text at top of screen
-    VDP_drawText(healthText, 1, 1);
-    VDP_drawText(staminaText, 1, 2);
-    VDP_drawText(zoneText, 1, 27);
-    
+
+    // Queue changed digit spans for the next vblank
+    for (u8 i = 0; i < 4; i++) flushNumber(&numbers[i]);
+
     // Draw debug info if needed
     #ifdef DEBUG
     char debugText[32];
-    sprintf(debugText, "X:%d Y:%d", fix32ToInt(player.posX), fix32ToInt(player.posY));
+    sprintf(debugText, "X:%d Y:%d", F32_toInt(player.posX), F32_toInt(player.posY));
     VDP_drawText(debugText, 25, 1);
-    
+
     sprintf(debugText, "STATE:%d", player.currentState);
     VDP_drawText(debugText, 25, 2);
     #endif
 }
 
+void hudShowZone(u8 zoneID) {
+    if (!hudVisible) return;
+
+    VDP_clearTextArea(HUD_ZONE_X, HUD_ZONE_Y, 39 - HUD_ZONE_X, 1);
+    VDP_drawText("ZONE:", HUD_ZONE_X, HUD_ZONE_Y);
+    VDP_drawText(zoneNames[zoneID], HUD_ZONE_X + 5, HUD_ZONE_Y);
+}
+
 void hudSetVisible(bool visible) {
+    if (visible && !hudVisible) {
+        hudVisible = TRUE;
+        drawStatic();
+        return;
+    }
+
     hudVisible = visible;
-    
+
     if (!visible) {
         // Clear HUD area
         VDP_clearTextArea(0, 0, 40, 3);
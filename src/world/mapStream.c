@@ -0,0 +1,184 @@
+#include <genesis.h>
+#include "world/mapStream.h"
+#include "core/config.h"
+#include "systems/transfer.h"
+
+MapStreamStats mapStreamStats;
+
+static VDPPlane streamPlane;
+static const TileMap* map = NULL;
+static u16 cellAttr;
+
+// World tile at the top-left of the plane window
+static s16 windowX;
+static s16 windowY;
+
+static s16 lastCameraX;
+static s16 lastCameraY;
+
+// Plane rows still to draw after mapStreamBegin (streaming waits for them)
+static u16 pendingRows;
+
+// DMA sources must stay valid until the queue is flushed in vblank.
+// Edges go out at XFER_PRIO_CRITICAL so they never carry over.
+static u16 columnBuffer[STREAM_MAX_COLUMNS][STREAM_PLANE_H];
+static u16 rowBuffer[STREAM_MAX_ROWS][STREAM_PLANE_W];
+
+static s16 clampWindow(s16 origin, u16 mapSize, u16 planeSize) {
+    if (mapSize <= planeSize || origin < 0) return 0;
+    if (origin > (s16) (mapSize - planeSize)) return mapSize - planeSize;
+    return origin;
+}
+
+/**
+ * Fill a plane column (indexed by plane row) with world column wx.
+ * World rows wrap onto plane rows modulo the plane height.
+ */
+static void buildColumn(u16* buffer, s16 wx) {
+    const u16* src = map->tilemap + (windowY * map->w) + wx;
+
+    for (s16 wy = windowY; wy < windowY + STREAM_PLANE_H; wy++) {
+        u16 cell = 0;
+        if (wx < map->w && wy < map->h) cell = *src + cellAttr;
+        buffer[wy & (STREAM_PLANE_H - 1)] = cell;
+        src += map->w;
+    }
+}
+
+/**
+ * Fill a plane row (indexed by plane column) with world row wy.
+ */
+static void buildRow(u16* buffer, s16 wy) {
+    const u16* src = map->tilemap + (wy * map->w) + windowX;
+
+    for (s16 wx = windowX; wx < windowX + STREAM_PLANE_W; wx++) {
+        u16 cell = 0;
+        if (wx < map->w && wy < map->h) cell = *src + cellAttr;
+        buffer[wx & (STREAM_PLANE_W - 1)] = cell;
+        src++;
+    }
+}
+
+static void queueColumn(u16 slot, s16 wx) {
+    buildColumn(columnBuffer[slot], wx);
+    transferQueue(DMA_VRAM, columnBuffer[slot],
+                  VDP_getPlaneAddress(streamPlane, wx & (STREAM_PLANE_W - 1), 0),
+                  STREAM_PLANE_H, STREAM_PLANE_W * 2, XFER_PRIO_CRITICAL);
+    mapStreamStats.columns++;
+}
+
+static void queueRow(u16 slot, s16 wy) {
+    buildRow(rowBuffer[slot], wy);
+    transferQueue(DMA_VRAM, rowBuffer[slot],
+                  VDP_getPlaneAddress(streamPlane, 0, wy & (STREAM_PLANE_H - 1)),
+                  STREAM_PLANE_W, 2, XFER_PRIO_CRITICAL);
+    mapStreamStats.rows++;
+}
+
+/**
+ * Draw up to maxRows of the window right away, top to bottom.
+ *
+ * These rows bypass the transfer queue on purpose: they share one row
+ * buffer (queuing a whole window would need a 4 KB plane copy in RAM), so
+ * each row must reach VRAM before the next is built. Callers are the zone
+ * loader, which runs behind a fade and keeps its own per-frame byte budget,
+ * and a camera jump, a one-off discontinuity where a single over-budget
+ * frame beats showing a half-drawn plane. No edge transfers are pending
+ * when they run: critical entries never carry over a flush.
+ */
+static void drawPendingRows(u16 maxRows) {
+    while (pendingRows && maxRows--) {
+        s16 wy = windowY + STREAM_PLANE_H - pendingRows;
+
+        buildRow(rowBuffer[0], wy);
+        DMA_doDma(DMA_VRAM, rowBuffer[0],
+                  VDP_getPlaneAddress(streamPlane, 0, wy & (STREAM_PLANE_H - 1)),
+                  STREAM_PLANE_W, 2);
+        pendingRows--;
+    }
+}
+
+/**
+ * Redraw the whole window right away (level load or camera jump).
+ */
+static void refreshWindow() {
+    pendingRows = STREAM_PLANE_H;
+    drawPendingRows(STREAM_PLANE_H);
+    mapStreamStats.refreshes++;
+}
+
+static void rememberCamera(s16 cameraX, s16 cameraY) {
+    lastCameraX = cameraX;
+    lastCameraY = cameraY;
+}
+
+void mapStreamInit(VDPPlane plane, const Image* level, u16 baseAttr, s16 cameraX, s16 cameraY) {
+    mapStreamBegin(plane, level, baseAttr, cameraX, cameraY);
+    refreshWindow();
+}
+
+void mapStreamBegin(VDPPlane plane, const Image* level, u16 baseAttr, s16 cameraX, s16 cameraY) {
+    streamPlane = plane;
+    map = level->tilemap;
+    cellAttr = baseAttr;
+
+    windowX = clampWindow((cameraX >> 3) - STREAM_MARGIN_X, map->w, STREAM_PLANE_W);
+    windowY = clampWindow((cameraY >> 3) - STREAM_MARGIN_Y, map->h, STREAM_PLANE_H);
+    pendingRows = STREAM_PLANE_H;
+
+    rememberCamera(cameraX, cameraY);
+}
+
+u16 mapStreamDrawRows(u16 maxRows) {
+    drawPendingRows(maxRows);
+    return pendingRows;
+}
+
+void mapStreamUpdate(s16 cameraX, s16 cameraY) {
+    if (!map || pendingRows) return;
+    if (cameraX == lastCameraX && cameraY == lastCameraY) return;
+
+    s16 newX = clampWindow((cameraX >> 3) - STREAM_MARGIN_X, map->w, STREAM_PLANE_W);
+    s16 newY = clampWindow((cameraY >> 3) - STREAM_MARGIN_Y, map->h, STREAM_PLANE_H);
+    s16 dx = newX - windowX;
+    s16 dy = newY - windowY;
+
+    if (dx > STREAM_MAX_COLUMNS || dx < -STREAM_MAX_COLUMNS ||
+        dy > STREAM_MAX_ROWS || dy < -STREAM_MAX_ROWS) {
+        // Camera jumped: redraw everything instead of streaming
+        windowX = newX;
+        windowY = newY;
+        refreshWindow();
+    } else if (dx || dy) {
+        s16 oldX = windowX;
+        s16 oldY = windowY;
+        u16 slot = 0;
+
+        // New window first so columns and rows agree on what they cover
+        windowX = newX;
+        windowY = newY;
+
+        if (dx > 0) {
+            for (s16 wx = oldX + STREAM_PLANE_W; wx < newX + STREAM_PLANE_W; wx++) queueColumn(slot++, wx);
+        } else {
+            for (s16 wx = newX; wx < oldX; wx++) queueColumn(slot++, wx);
+        }
+
+        slot = 0;
+        if (dy > 0) {
+            for (s16 wy = oldY + STREAM_PLANE_H; wy < newY + STREAM_PLANE_H; wy++) queueRow(slot++, wy);
+        } else {
+            for (s16 wy = newY; wy < oldY; wy++) queueRow(slot++, wy);
+        }
+    }
+
+    rememberCamera(cameraX, cameraY);
+}
+
+u16 mapStreamWidth() {
+    return map ? map->w * TILE_DIMENSION : SCREEN_WIDTH;
+}
+
+u16 mapStreamHeight() {
+    return map ? map->h * TILE_DIMENSION : SCREEN_HEIGHT;
+}
@@ -0,0 +1,110 @@
+#include <genesis.h>
+#include "world/objectSpawner.h"
+
+ObjectSpawnerStats objectSpawnerStats;
+
+// Survives zone loads; cleared only for a new game
+static u8 collected[ZONE_COUNT][OBJ_MAX_PER_ZONE / 8];
+
+static const ZoneObjectList* layout;
+static u8 objectCount;
+static u8* zoneCollected;
+
+// Objects [left, right) are live (or collected); handles index by object
+static u8 left;
+static u8 right;
+static EntityHandle handles[OBJ_MAX_PER_ZONE];
+
+void objectSpawnerInit() {
+    memset(collected, 0, sizeof(collected));
+    memset(&objectSpawnerStats, 0, sizeof(objectSpawnerStats));
+    objectSpawnerSetZone(0, NULL);
+}
+
+void objectSpawnerSetZone(u8 zoneID, const ZoneObjectList* list) {
+    if (zoneID >= ZONE_COUNT) zoneID = ZONE_HUB;
+
+    layout = (list && list->count) ? list : NULL;
+    objectCount = layout ? min(layout->count, OBJ_MAX_PER_ZONE) : 0;
+    zoneCollected = collected[zoneID];
+    left = 0;
+    right = 0;
+    memset(handles, 0, sizeof(handles));
+
+#ifdef DEBUG
+    if (layout) {
+        if (layout->count > OBJ_MAX_PER_ZONE) kprintf("objects: zone %u has %u objects, max %u", zoneID, layout->count, OBJ_MAX_PER_ZONE);
+        for (u8 i = 1; i < layout->count; i++) {
+            if (layout->objects[i].x < layout->objects[i - 1].x) kprintf("objects: zone %u not sorted at %u", zoneID, i);
+        }
+    }
+#endif
+}
+
+bool objectSpawnerCollected(u8 index) {
+    return (zoneCollected[index >> 3] >> (index & 7)) & 1;
+}
+
+void objectSpawnerCollect(const Entity* entity) {
+    u8 index = entity->layoutIndex;
+
+    if (!layout || index == OBJ_INDEX_NONE) return;
+    zoneCollected[index >> 3] |= 1 << (index & 7);
+}
+
+static void spawn(u8 index) {
+    objectSpawnerStats.cursorSteps++;
+
+    if (objectSpawnerCollected(index)) {
+        objectSpawnerStats.skipped++;
+        return;
+    }
+
+    const ZoneObject* obj = &layout->objects[index];
+    EntityHandle h = entitySpawn(obj->type, FIX32(obj->x), FIX32(obj->y), obj->param);
+    Entity* e = entityGet(h);
+
+    // A full pool leaves the object to the next time it scrolls into range
+    if (!e) return;
+
+    e->layoutIndex = index;
+    handles[index] = h;
+    objectSpawnerStats.spawns++;
+}
+
+static void release(u8 index) {
+    objectSpawnerStats.cursorSteps++;
+
+    // Stale if the entity despawned itself (collected, expired)
+    if (entityGet(handles[index])) {
+        entityDespawn(handles[index]);
+        objectSpawnerStats.releases++;
+    }
+    handles[index] = ENTITY_NONE;
+}
+
+void objectSpawnerUpdate(s16 cameraX) {
+    if (!layout) return;
+
+    const ZoneObject* objects = layout->objects;
+    u8 count = objectCount;
+    s16 spawnLeft = cameraX - OBJ_SPAWN_MARGIN;
+    s16 spawnRight = cameraX + SCREEN_WIDTH + OBJ_SPAWN_MARGIN;
+    s16 releaseLeft = cameraX - OBJ_RELEASE_MARGIN;
+    s16 releaseRight = cameraX + SCREEN_WIDTH + OBJ_RELEASE_MARGIN;
+
+    // Release what fell past the wider window
+    while (right > left && objects[right - 1].x >= releaseRight) release(--right);
+    while (left < right && objects[left].x < releaseLeft) release(left++);
+
+    // Empty range (zone start, camera jump): re-seat both cursors
+    if (left == right) {
+        while (left < count && objects[left].x < spawnLeft) left++;
+        while (left > 0 && objects[left - 1].x >= spawnLeft) left--;
+        right = left;
+    }
+
+    // Spawn what entered the spawn window
+    while (right < count && objects[right].x < spawnRight) spawn(right++);
+    while (left > 0 && objects[left - 1].x >= spawnLeft) spawn(--left);
+}
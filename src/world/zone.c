@@ -1,6 +1,11 @@
 #include <genesis.h>
 #include "world/zone.h"
 #include "core/config.h"
+#include "core/game.h"
+#include "world/zoneLoader.h"
+#include "ui/hud.h"
+#include "entities/entity.h"
+#include "world/objectSpawner.h"
 
 // Global current zone
 Zone currentZone;
@@ -12,13 +17,25 @@ void zoneInit() {
     currentZone.currentSubZone = 0;
     currentZone.discovered = TRUE;
     currentZone.completed = FALSE;
+    
+    tileCollisionSetMap(getZoneCollisionMap(currentZone.zoneID));
+
+    // Objects spawn from the first camera update
+    objectSpawnerInit();
+    objectSpawnerSetZone(currentZone.zoneID, getZoneObjects(currentZone.zoneID));
 }
 
 void loadZone(u8 zoneID) {
     // Unload current zone first
     unloadZone();
     
-    // Load new zone
+    // Level tiles, map and palette load over the next frames behind a fade;
+    // the zone switches over once the loader has VRAM for it (zoneCommit)
+    zoneLoaderStart(zoneID);
+    gameChangeState(GAME_STATE_TRANSITION);
+}
+
+void zoneCommit(u8 zoneID) {
     currentZone.zoneID = zoneID;
     currentZone.discovered = TRUE;
     
@@ -52,12 +69,24 @@ void loadZone(u8 zoneID) {
     
     currentZone.currentSubZone = 0;
     
-    // TODO: Load zone tilemap, sprites, enemies, etc.
+    // Collision layer
+    tileCollisionSetMap(getZoneCollisionMap(zoneID));
+    hudShowZone(zoneID);
+    
+    // Enemies and pickups spawn as the camera reaches them
+    objectSpawnerSetZone(zoneID, getZoneObjects(zoneID));
+}
+
+void zoneAbort() {
+    // The old level stays: respawn its objects (unloadZone despawned them)
+    objectSpawnerSetZone(currentZone.zoneID, getZoneObjects(currentZone.zoneID));
 }
 
 void unloadZone() {
-    // TODO: Unload current zone assets
-    // Free sprites, clear tilemap, etc.
+    // Entities belong to the zone that spawned them
+    entityDespawnAll();
+
+    // TODO: Unload remaining zone assets
 }
 
 u8 getCurrentZone() {
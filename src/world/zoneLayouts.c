@@ -0,0 +1,206 @@
+#include <genesis.h>
+#include <resources.h>
+#include "world/zone.h"
+#include "systems/tileCollision.h"
+#include "systems/parallax.h"
+#include "world/objectSpawner.h"
+
+// Per-zone ROM layouts: collision layer, level map, backdrop parallax and
+// object placement.
+// The collision grids mirror the level images in res/ cell for cell.
+
+// HUB: 128x32 tiles (1024x256 px), level image res/hub.png
+//
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ................................................................................................................................
+// ........................................========................................................................................
+// ................................................................................................................................
+// ....................................................................................................============................
+// ................................................................................................................................
+// ..........========..............................................................................................................
+// ................................................................................................................................
+// ................................................................========............####........................................
+// ....................................................................................####........................................
+// ..............................####..................................................####........................................
+// ..............................####..................................................########....................................
+// ..............................####..................................................########........................^^^^........
+// ..............................####................^^^^..............................########....................................
+// ################################################################################################################################
+// ################################################################################################################################
+// ################################################################################################################################
+// ################################################################################################################################
+//
+// '#' solid, '=' one-way platform, '^' hazard, '.' empty
+static const u8 hubCells[32 * 32] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const CollisionMap hubCollision = { 128, 32, 5, hubCells };
+
+// Indexed by zone ID; zones without their own layout yet share the HUB room
+static const CollisionMap* const zoneCollision[] = {
+    &hubCollision,  // ZONE_CPU
+    &hubCollision,  // ZONE_GPU
+    &hubCollision,  // ZONE_RAM
+    &hubCollision,  // ZONE_STORAGE
+    &hubCollision,  // ZONE_HUB
+    &hubCollision,  // ZONE_BIOS
+    &hubCollision   // ZONE_RESERVED
+};
+
+static const Image* const zoneLevel[] = {
+    &hubLevel,      // ZONE_CPU
+    &hubLevel,      // ZONE_GPU
+    &hubLevel,      // ZONE_RAM
+    &hubLevel,      // ZONE_STORAGE
+    &hubLevel,      // ZONE_HUB
+    &hubLevel,      // ZONE_BIOS
+    &hubLevel       // ZONE_RESERVED
+};
+
+// Backdrop bands, top to bottom (lines add up to SCROLL_LINES)
+static const ParallaxBand cpuBands[] = {
+    { 56, SCROLL_FACTOR(0.0625) },  // Far skyline
+    { 48, SCROLL_FACTOR(0.125) },
+    { 40, SCROLL_FACTOR(0.25) },
+    { 40, SCROLL_FACTOR(0.375) },
+    { 40, SCROLL_FACTOR(0.5) }      // Nearest strip
+};
+
+static const ParallaxBand storageBands[] = {
+    { 64, SCROLL_FACTOR(0.0625) },
+    { 32, SCROLL_FACTOR(0.125) },
+    { 32, SCROLL_FACTOR(0.1875) },
+    { 32, SCROLL_FACTOR(0.25) },
+    { 32, SCROLL_FACTOR(0.3125) },
+    { 32, SCROLL_FACTOR(0.375) }
+};
+
+static const ParallaxSet cpuParallax = { 5, cpuBands };
+static const ParallaxSet storageParallax = { 6, storageBands };
+
+static const ParallaxSet* const zoneParallax[] = {
+    &cpuParallax,       // ZONE_CPU
+    NULL,               // ZONE_GPU
+    NULL,               // ZONE_RAM
+    &storageParallax,   // ZONE_STORAGE
+    NULL,               // ZONE_HUB
+    NULL,               // ZONE_BIOS
+    NULL                // ZONE_RESERVED
+};
+
+// Objects, sorted by X (objectSpawner.c walks them with cursors)
+static const ZoneObject hubObjects[] = {
+    { 104, 148, ENTITY_TYPE_PICKUP, 0 },    // Low platform
+    { 160, 208, ENTITY_TYPE_ENEMY, 1 },
+    { 252, 180, ENTITY_TYPE_PICKUP, 0 },    // Pillar top
+    { 348, 116, ENTITY_TYPE_PICKUP, 0 },    // High platform
+    { 448, 208, ENTITY_TYPE_ENEMY, 1 },
+    { 540, 164, ENTITY_TYPE_PICKUP, 0 },
+    { 600, 208, ENTITY_TYPE_ENEMY, -1 },
+    { 700, 164, ENTITY_TYPE_PICKUP, 0 },    // Block top
+    { 760, 208, ENTITY_TYPE_ENEMY, 1 },
+    { 844, 132, ENTITY_TYPE_PICKUP, 0 },
+    { 980, 208, ENTITY_TYPE_ENEMY, -1 }
+};
+
+static const ZoneObjectList hubObjectList = { 11, hubObjects };
+
+const CollisionMap* getZoneCollisionMap(u8 zoneID) {
+    if (zoneID > ZONE_RESERVED) return &hubCollision;
+    return zoneCollision[zoneID];
+}
+
+const Image* getZoneLevelImage(u8 zoneID) {
+    if (zoneID > ZONE_RESERVED) return &hubLevel;
+    return zoneLevel[zoneID];
+}
+
+const ParallaxSet* getZoneParallax(u8 zoneID) {
+    if (zoneID > ZONE_RESERVED) return NULL;
+    return zoneParallax[zoneID];
+}
+
+const ZoneObjectList* getZoneObjects(u8 zoneID) {
+    (void) zoneID;
+
+    // Every zone shares the HUB room for now
+    return &hubObjectList;
+}
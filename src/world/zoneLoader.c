@@ -0,0 +1,224 @@
+#include <genesis.h>
+#include "world/zoneLoader.h"
+#include "world/zone.h"
+#include "world/mapStream.h"
+#include "assetLoader.h"
+#include "camera.h"
+#include "systems/tileAlloc.h"
+#include "systems/transfer.h"
+#include "systems/parallax.h"
+
+// Bytes of one plane row of map entries
+#define MAP_ROW_BYTES (STREAM_PLANE_W * 2)
+
+ZoneLoadStats zoneLoadStats;
+
+static ZoneLoadStep step = ZONE_LOAD_IDLE;
+static bool stepEntered;
+
+static u8 loadZoneID;
+static const Image* level;
+static TileSet* unpacked = NULL;
+static const u32* tileData;
+static u16 tilesDone;
+
+// Progress in bytes (tiles + map + palette)
+static u32 loadDone;
+static u32 loadTotal;
+
+// Target for the fade in: current palettes with PAL1 swapped for the level's
+static u16 fadePalette[64];
+
+static void gotoStep(ZoneLoadStep next) {
+    step = next;
+    stepEntered = FALSE;
+}
+
+static void releaseUnpacked() {
+    if (unpacked) {
+        MEM_free(unpacked);
+        unpacked = NULL;
+    }
+}
+
+/**
+ * Decompress the tileset in RAM if needed. SGDK's decompressors can't be
+ * resumed, so this is one step on its own frame; uncompressed tilesets are
+ * uploaded straight from ROM.
+ */
+static void stepUnpack() {
+    const TileSet* tileset = level->tileset;
+
+    // Allocate the new level's block before giving up the old one, so a
+    // failed load leaves the old level intact in VRAM
+    u16 index = tileAlloc(TILE_POOL_ZONE, tileset->numTile);
+
+    if (index == TILE_ALLOC_NONE) {
+        #ifdef DEBUG
+        kprintf("zone load: no VRAM for %u tiles", tileset->numTile);
+        tileAllocDump();
+        #endif
+        // Fade back in on the old level, still the current zone
+        zoneAbort();
+        PAL_fadeInAll(fadePalette, ZONE_LOAD_FADE_FRAMES, TRUE);
+        gotoStep(ZONE_LOAD_FADE_IN);
+        return;
+    }
+
+    tileFree(TILE_POOL_ZONE, levelTileIndex);
+    levelTileIndex = index;
+    zoneCommit(loadZoneID);
+
+    if (tileset->compression != COMPRESSION_NONE) {
+        unpacked = unpackTileSet(tileset, NULL);
+        tileData = unpacked->tiles;
+    } else {
+        tileData = tileset->tiles;
+    }
+
+    tilesDone = 0;
+    gotoStep(ZONE_LOAD_TILES);
+}
+
+static u16 stepTiles(u16 budget) {
+    u16 numTile = level->tileset->numTile;
+    u16 count = min(numTile - tilesDone, budget / TILE_SIZE);
+
+    if (count) {
+        // Read in vblank (possibly a later one); the buffer lives until MAP.
+        // A full queue refuses the chunk: it is retried next frame.
+        if (!transferTiles(tileData + (tilesDone * (TILE_SIZE / 4)),
+                           levelTileIndex + tilesDone, count, XFER_PRIO_LOW)) return 0;
+        tilesDone += count;
+    }
+
+    if (tilesDone >= numTile) gotoStep(ZONE_LOAD_MAP);
+
+    return count * TILE_SIZE;
+}
+
+static u16 stepMap(u16 budget) {
+    if (!stepEntered) {
+        // Tiles may still be queued behind higher priority work
+        if (transferPending(XFER_PRIO_LOW)) return 0;
+
+        releaseUnpacked();
+        mapStreamBegin(BG_A,
+                       level,
+                       TILE_ATTR_FULL(PAL1,
+                           FALSE,
+                           FALSE,
+                           FALSE,
+                           levelTileIndex),
+                       currentCameraX, currentCameraY);
+        stepEntered = TRUE;
+    }
+
+    u16 rows = min(ZONE_LOAD_ROWS_PER_FRAME, budget / MAP_ROW_BYTES);
+    u16 before = mapStreamDrawRows(0);
+    u16 after = mapStreamDrawRows(rows);
+
+    if (!after) gotoStep(ZONE_LOAD_PALETTE);
+
+    return (before - after) * MAP_ROW_BYTES;
+}
+
+static u16 stepPalette() {
+    memcpy(fadePalette + (PAL1 * 16), level->palette->data, 16 * 2);
+    parallaxSetBands(getZoneParallax(loadZoneID));
+
+    PAL_fadeInAll(fadePalette, ZONE_LOAD_FADE_FRAMES, TRUE);
+    gotoStep(ZONE_LOAD_FADE_IN);
+
+    return 16 * 2;
+}
+
+void zoneLoaderStart(u8 zoneID) {
+    // Keep the palettes of an interrupted load, the screen is already dark
+    if (step == ZONE_LOAD_IDLE) PAL_getColors(0, fadePalette, 64);
+
+    // Tiles of an interrupted load may still be queued from the unpack
+    // buffer: drop them before it is freed (the new load sends its own)
+    if (unpacked) transferCancel(XFER_PRIO_LOW);
+    releaseUnpacked();
+    memset(&zoneLoadStats, 0, sizeof(zoneLoadStats));
+
+    loadZoneID = zoneID;
+    level = getZoneLevelImage(zoneID);
+    loadDone = 0;
+    loadTotal = (level->tileset->numTile * TILE_SIZE) +
+                (STREAM_PLANE_H * MAP_ROW_BYTES) + (16 * 2);
+
+    PAL_fadeOutAll(ZONE_LOAD_FADE_FRAMES, TRUE);
+    gotoStep(ZONE_LOAD_FADE_OUT);
+}
+
+bool zoneLoaderUpdate() {
+    if (step == ZONE_LOAD_IDLE) return FALSE;
+
+    zoneLoadStats.frames++;
+
+    if (step == ZONE_LOAD_FADE_OUT) {
+        if (!PAL_isDoingFade()) gotoStep(ZONE_LOAD_UNPACK);
+        return TRUE;
+    }
+
+    if (step == ZONE_LOAD_FADE_IN) {
+        if (PAL_isDoingFade()) return TRUE;
+
+        step = ZONE_LOAD_IDLE;
+        #ifdef DEBUG
+        tileAllocDump();
+        kprintf("zone load: %u frames (%u working), %lu bytes, peak %u/frame",
+                zoneLoadStats.frames, zoneLoadStats.workFrames,
+                zoneLoadStats.dmaBytes, zoneLoadStats.maxFrameBytes);
+        #endif
+        return FALSE;
+    }
+
+    zoneLoadStats.workFrames++;
+
+    if (step == ZONE_LOAD_UNPACK) {
+        stepUnpack();
+        return TRUE;
+    }
+
+    // Upload steps share one byte budget per frame
+    u16 sent = 0;
+
+    while (sent < ZONE_LOAD_DMA_BUDGET && step != ZONE_LOAD_FADE_IN) {
+        ZoneLoadStep current = step;
+        u16 budget = ZONE_LOAD_DMA_BUDGET - sent;
+        u16 used;
+
+        if (current == ZONE_LOAD_TILES) used = stepTiles(budget);
+        else if (current == ZONE_LOAD_MAP) used = stepMap(budget);
+        else used = stepPalette();
+
+        sent += used;
+
+        // Queued tiles must reach vblank before the unpack buffer is freed
+        if (current == ZONE_LOAD_TILES && step != current) break;
+        if (!used && step == current) break;
+    }
+
+    loadDone += sent;
+    zoneLoadStats.dmaBytes += sent;
+    if (sent > zoneLoadStats.maxFrameBytes) zoneLoadStats.maxFrameBytes = sent;
+
+    return TRUE;
+}
+
+bool zoneLoaderBusy() {
+    return step != ZONE_LOAD_IDLE;
+}
+
+ZoneLoadStep zoneLoaderStep() {
+    return step;
+}
+
+u8 zoneLoaderProgress() {
+    if (step == ZONE_LOAD_IDLE) return 100;
+    if (!loadTotal) return 0;
+    return (loadDone * 100) / loadTotal;
+}
@@ -0,0 +1,345 @@
+// Bakes per-frame hitbox/hurtbox lists into ROM tables.
+//
+//   bakeboxes <spec.boxes> <out.c> <out.h>
+//
+// Reads a text spec of animation sequences whose frames carry their boxes
+// (see res/anims.boxes) and writes the AnimSeq tables with a FrameBoxes
+// entry per frame, plus standalone FrameBoxes sets. Identical box lists are
+// emitted once and shared. Built and run by the host Makefile.
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_NAME 48
+#define MAX_SETS 64
+#define MAX_FRAMES 512
+#define MAX_LISTS 512
+#define MAX_BOXES 16            // Per frame: hurtboxes then hitboxes
+
+typedef struct {
+    int x, y, w, h;
+} Box;
+
+typedef struct {
+    Box boxes[MAX_BOXES];
+    int hurtCount;
+    int hitCount;
+} BoxList;
+
+typedef struct {
+    int frame;
+    int duration;               // -1: hold
+    char event[MAX_NAME];       // Empty: none
+    int arg;
+    int list;                   // Index into lists
+} Frame;
+
+typedef struct {
+    char name[MAX_NAME];
+    int isSeq;                  // 0: standalone box set
+    int loop;
+    int firstFrame;
+    int frameCount;
+    int list;                   // Box set only
+} Set;
+
+static Set sets[MAX_SETS];
+static int setCount;
+static Frame frames[MAX_FRAMES];
+static int frameCount;
+static BoxList lists[MAX_LISTS];
+static int listCount;
+
+static const char* specPath;
+static int lineNo;
+
+static void fail(const char* fmt, ...) {
+    va_list ap;
+
+    fprintf(stderr, "%s:%d: ", specPath, lineNo);
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fputc('\n', stderr);
+    exit(1);
+}
+
+static int parseInt(const char* s, int min, int max, const char* what) {
+    char* end;
+    long v = strtol(s, &end, 10);
+
+    if (!*s || *end) fail("bad %s '%s'", what, s);
+    if (v < min || v > max) fail("%s %ld out of range %d..%d", what, v, min, max);
+    return (int) v;
+}
+
+/**
+ * Box list being filled: the current frame's, or the current box set's.
+ */
+static BoxList* openList() {
+    if (!setCount) fail("box outside a seq or boxes block");
+
+    Set* set = &sets[setCount - 1];
+    if (set->isSeq) {
+        if (!set->frameCount) fail("box before the first frame of '%s'", set->name);
+        return &lists[frames[frameCount - 1].list];
+    }
+    return &lists[set->list];
+}
+
+static int newList() {
+    if (listCount >= MAX_LISTS) fail("too many box lists");
+    memset(&lists[listCount], 0, sizeof(BoxList));
+    return listCount++;
+}
+
+static void checkName(const char* name) {
+    if (!isalpha((unsigned char) name[0]) && name[0] != '_') fail("bad name '%s'", name);
+    for (const char* c = name; *c; c++) {
+        if (!isalnum((unsigned char) *c) && *c != '_') fail("bad name '%s'", name);
+    }
+    if (strlen(name) >= MAX_NAME) fail("name too long '%s'", name);
+    for (int i = 0; i < setCount; i++) {
+        if (!strcmp(sets[i].name, name)) fail("duplicate name '%s'", name);
+    }
+}
+
+static void parseLine(char** tok, int n) {
+    if (!strcmp(tok[0], "seq")) {
+        if (n != 3 || (strcmp(tok[2], "loop") && strcmp(tok[2], "once"))) fail("usage: seq <name> loop|once");
+        checkName(tok[1]);
+        if (setCount >= MAX_SETS) fail("too many sets");
+
+        Set* set = &sets[setCount++];
+        memset(set, 0, sizeof(Set));
+        strcpy(set->name, tok[1]);
+        set->isSeq = 1;
+        set->loop = !strcmp(tok[2], "loop");
+        set->firstFrame = frameCount;
+    } else if (!strcmp(tok[0], "boxes")) {
+        if (n != 2) fail("usage: boxes <name>");
+        checkName(tok[1]);
+        if (setCount >= MAX_SETS) fail("too many sets");
+
+        Set* set = &sets[setCount++];
+        memset(set, 0, sizeof(Set));
+        strcpy(set->name, tok[1]);
+        set->list = newList();
+    } else if (!strcmp(tok[0], "frame")) {
+        if (n != 3 && n != 5) fail("usage: frame <sprite frame> <duration|hold> [<event> <arg>]");
+        if (!setCount || !sets[setCount - 1].isSeq) fail("frame outside a seq block");
+
+        Set* set = &sets[setCount - 1];
+        if (set->frameCount >= 255) fail("too many frames in '%s'", set->name);
+        if (frameCount >= MAX_FRAMES) fail("too many frames");
+
+        Frame* f = &frames[frameCount++];
+        memset(f, 0, sizeof(Frame));
+        f->frame = parseInt(tok[1], 0, 255, "sprite frame");
+        f->duration = !strcmp(tok[2], "hold") ? -1 : parseInt(tok[2], 1, 255, "duration");
+        if (n == 5) {
+            if (strlen(tok[3]) >= MAX_NAME) fail("event name too long");
+            for (char* c = tok[3]; *c; c++) *c = toupper((unsigned char) *c);
+            strcpy(f->event, tok[3]);
+            f->arg = parseInt(tok[4], 0, 255, "event arg");
+        }
+        f->list = newList();
+        set->frameCount++;
+    } else if (!strcmp(tok[0], "hurt") || !strcmp(tok[0], "hit")) {
+        if (n != 5) fail("usage: %s <x> <y> <w> <h>", tok[0]);
+
+        BoxList* list = openList();
+        if (list->hurtCount + list->hitCount >= MAX_BOXES) fail("too many boxes on one frame");
+
+        Box b = {
+            parseInt(tok[1], -128, 127, "x"), parseInt(tok[2], -128, 127, "y"),
+            parseInt(tok[3], 1, 255, "width"), parseInt(tok[4], 1, 255, "height")
+        };
+
+        // Hurtboxes first, so the list is one array split by the counts
+        if (tok[0][1] == 'u') {
+            if (list->hitCount) fail("hurt boxes must come before hit boxes");
+            list->boxes[list->hurtCount++] = b;
+        } else {
+            list->boxes[list->hurtCount + list->hitCount++] = b;
+        }
+    } else {
+        fail("unknown directive '%s'", tok[0]);
+    }
+}
+
+static void parse(FILE* in) {
+    char line[256];
+
+    while (fgets(line, sizeof(line), in)) {
+        char* tok[8];
+        int n = 0;
+
+        lineNo++;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = 0;
+
+        for (char* t = strtok(line, " \t\r\n"); t; t = strtok(NULL, " \t\r\n")) {
+            if (n == 8) fail("too many fields");
+            tok[n++] = t;
+        }
+        if (n) parseLine(tok, n);
+    }
+
+    for (int i = 0; i < setCount; i++) {
+        if (sets[i].isSeq && !sets[i].frameCount) fail("seq '%s' has no frames", sets[i].name);
+    }
+}
+
+static int sameList(const BoxList* a, const BoxList* b) {
+    return a->hurtCount == b->hurtCount && a->hitCount == b->hitCount &&
+           !memcmp(a->boxes, b->boxes, sizeof(Box) * (a->hurtCount + a->hitCount));
+}
+
+static void writeSource(FILE* out, const char* header) {
+    int emitted[MAX_LISTS];     // Array each list is emitted as, -1 if empty
+
+    fprintf(out, "// Generated by tools/bakeboxes from %s - do not edit\n\n", specPath);
+    fprintf(out, "#include <genesis.h>\n#include \"%s\"\n\n", header);
+
+    // Shared box arrays
+    for (int i = 0; i < listCount; i++) {
+        const BoxList* l = &lists[i];
+
+        emitted[i] = -1;
+        if (!l->hurtCount && !l->hitCount) continue;
+
+        for (int j = 0; j < i; j++) {
+            if (emitted[j] == j && sameList(&lists[j], l)) {
+                emitted[i] = j;
+                break;
+            }
+        }
+        if (emitted[i] >= 0) continue;
+
+        emitted[i] = i;
+        fprintf(out, "static const FrameBox boxes%d[] = {", i);
+        for (int b = 0; b < l->hurtCount + l->hitCount; b++) {
+            fprintf(out, "%s { %d, %d, %d, %d }", b ? "," : "",
+                    l->boxes[b].x, l->boxes[b].y, l->boxes[b].w, l->boxes[b].h);
+        }
+        fprintf(out, " };\n");
+    }
+
+    for (int s = 0; s < setCount; s++) {
+        const Set* set = &sets[s];
+
+        fprintf(out, "\n");
+        if (!set->isSeq) {
+            const BoxList* l = &lists[set->list];
+            if (emitted[set->list] < 0) {
+                fprintf(out, "const FrameBoxes %s = { NULL, 0, 0 };\n", set->name);
+            } else {
+                fprintf(out, "const FrameBoxes %s = { boxes%d, %d, %d };\n",
+                        set->name, emitted[set->list], l->hurtCount, l->hitCount);
+            }
+            continue;
+        }
+
+        fprintf(out, "static const AnimSeqFrame %sFrames[] = {\n", set->name);
+        for (int f = 0; f < set->frameCount; f++) {
+            const Frame* fr = &frames[set->firstFrame + f];
+            char duration[16];
+
+            if (fr->duration < 0) strcpy(duration, "ANIM_HOLD");
+            else sprintf(duration, "%d", fr->duration);
+
+            if (fr->event[0]) {
+                fprintf(out, "    { %d, %s, ANIM_EVENT_%s, %d },\n", fr->frame, duration, fr->event, fr->arg);
+            } else {
+                fprintf(out, "    { %d, %s, ANIM_EVENT_NONE, 0 },\n", fr->frame, duration);
+            }
+        }
+        fprintf(out, "};\n");
+
+        fprintf(out, "static const FrameBoxes %sBoxes[] = {\n", set->name);
+        for (int f = 0; f < set->frameCount; f++) {
+            const Frame* fr = &frames[set->firstFrame + f];
+            const BoxList* l = &lists[fr->list];
+
+            if (emitted[fr->list] < 0) {
+                fprintf(out, "    { NULL, 0, 0 },\n");
+            } else {
+                fprintf(out, "    { boxes%d, %d, %d },\n", emitted[fr->list], l->hurtCount, l->hitCount);
+            }
+        }
+        fprintf(out, "};\n");
+
+        fprintf(out, "const AnimSeq %s = { %sFrames, %d, %s, %sBoxes };\n",
+                set->name, set->name, set->frameCount, set->loop ? "TRUE" : "FALSE", set->name);
+    }
+}
+
+static void writeHeader(FILE* out, const char* guard) {
+    fprintf(out, "// Generated by tools/bakeboxes from %s - do not edit\n\n", specPath);
+    fprintf(out, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(out, "#include <genesis.h>\n#include \"systems/animBatch.h\"\n\n");
+
+    for (int s = 0; s < setCount; s++) {
+        fprintf(out, "extern const %s %s;\n", sets[s].isSeq ? "AnimSeq" : "FrameBoxes", sets[s].name);
+    }
+    fprintf(out, "\n#endif // %s\n", guard);
+}
+
+/**
+ * "inc/entities/animData.h" -> include path "entities/animData.h", guard ANIM_DATA_H
+ */
+static void headerNames(const char* path, char* include, char* guard) {
+    const char* inc = strstr(path, "inc/");
+    const char* base = strrchr(path, '/');
+
+    strcpy(include, inc ? inc + 4 : (base ? base + 1 : path));
+
+    base = base ? base + 1 : path;
+    char* g = guard;
+    for (const char* c = base; *c && *c != '.'; c++) {
+        if (isupper((unsigned char) *c) && c != base) *g++ = '_';
+        *g++ = toupper((unsigned char) *c);
+    }
+    strcpy(g, "_H");
+}
+
+int main(int argc, char** argv) {
+    char include[256];
+    char guard[256];
+
+    if (argc != 4) {
+        fprintf(stderr, "usage: %s <spec.boxes> <out.c> <out.h>\n", argv[0]);
+        return 2;
+    }
+    if (strlen(argv[3]) >= sizeof(include)) return 2;
+
+    specPath = argv[1];
+    FILE* in = fopen(specPath, "r");
+    if (!in) {
+        perror(specPath);
+        return 1;
+    }
+    parse(in);
+    fclose(in);
+
+    // Report paths relative to the project, whatever directory make ran in
+    const char* res = strstr(specPath, "res/");
+    if (res) specPath = res;
+
+    headerNames(argv[3], include, guard);
+
+    FILE* src = fopen(argv[2], "w");
+    FILE* hdr = fopen(argv[3], "w");
+    if (!src || !hdr) {
+        perror("output");
+        return 1;
+    }
+    writeSource(src, include);
+    writeHeader(hdr, guard);
+
+    return (fclose(src) || fclose(hdr)) ? 1 : 0;
+}
@@ -0,0 +1,242 @@
+// Bakes motion curves (per-frame velocity tables) into ROM tables.
+//
+//   bakecurves <spec.curves> <out.c> <out.h>
+//
+// Reads a text spec of jump arcs and eased moves (see res/motion.curves) and
+// writes a MotionCurve per entry, its velocities quantized to fix32. Eased
+// moves are quantized on the running position, so their frames always add
+// up to the exact distance. Built and run by the host Makefile.
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_NAME 48
+#define MAX_CURVES 32
+#define MAX_LENGTH 255          // MotionCurve.length is a u8
+#define FIX32_ONE 1024          // fix32 is 22.10
+
+typedef struct {
+    char name[MAX_NAME];
+    char what[64];              // Summary written next to the table
+    long velocity[MAX_LENGTH];  // fix32 raw values
+    int length;
+} Curve;
+
+static Curve curves[MAX_CURVES];
+static int curveCount;
+
+static const char* specPath;
+static int lineNo;
+
+static void fail(const char* fmt, ...) {
+    va_list ap;
+
+    fprintf(stderr, "%s:%d: ", specPath, lineNo);
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fputc('\n', stderr);
+    exit(1);
+}
+
+static double parseNumber(const char* s, double min, double max, const char* what) {
+    char* end;
+    double v = strtod(s, &end);
+
+    if (!*s || *end) fail("bad %s '%s'", what, s);
+    if (v < min || v > max) fail("%s %g out of range %g..%g", what, v, min, max);
+    return v;
+}
+
+static void checkName(const char* name) {
+    if (!isalpha((unsigned char) name[0]) && name[0] != '_') fail("bad name '%s'", name);
+    for (const char* c = name; *c; c++) {
+        if (!isalnum((unsigned char) *c) && *c != '_') fail("bad name '%s'", name);
+    }
+    if (strlen(name) >= MAX_NAME) fail("name too long '%s'", name);
+    for (int i = 0; i < curveCount; i++) {
+        if (!strcmp(curves[i].name, name)) fail("duplicate name '%s'", name);
+    }
+}
+
+static Curve* newCurve(const char* name) {
+    checkName(name);
+    if (curveCount >= MAX_CURVES) fail("too many curves");
+
+    Curve* c = &curves[curveCount++];
+    memset(c, 0, sizeof(Curve));
+    strcpy(c->name, name);
+    return c;
+}
+
+static long toFix32(double v) {
+    return lround(v * FIX32_ONE);
+}
+
+/**
+ * Rising part of a jump: the takeoff velocity, slowed by gravity each frame
+ * until it stops going up. Gravity takes over at the apex.
+ */
+static void bakeRise(Curve* c, double takeoff, double gravity) {
+    double height = 0;
+
+    for (double v = takeoff; v < 0; v += gravity) {
+        if (c->length >= MAX_LENGTH) fail("'%s' rises for more than %d frames", c->name, MAX_LENGTH);
+        c->velocity[c->length++] = toFix32(v);
+        height -= (double) toFix32(v) / FIX32_ONE;
+    }
+    snprintf(c->what, sizeof(c->what), "%d frames, rises %.1f px", c->length, height);
+}
+
+static double ease(const char* kind, double t) {
+    if (!strcmp(kind, "out")) return 1 - (1 - t) * (1 - t);
+    if (!strcmp(kind, "inout")) return t * t * (3 - 2 * t);
+    return t;
+}
+
+/**
+ * Speed per frame to cover a distance over a number of frames along an
+ * easing curve; quantized on the position so the total is exact.
+ */
+static void bakeEase(Curve* c, double distance, int frames, const char* kind) {
+    long prev = 0;
+
+    for (int i = 0; i < frames; i++) {
+        long pos = toFix32(distance * ease(kind, (double) (i + 1) / frames));
+
+        c->velocity[c->length++] = pos - prev;
+        prev = pos;
+    }
+    snprintf(c->what, sizeof(c->what), "%d frames, %.1f px, ease %s", frames, distance, kind);
+}
+
+static void parseLine(char** tok, int n) {
+    if (!strcmp(tok[0], "rise")) {
+        if (n != 4) fail("usage: rise <name> <takeoff velocity> <gravity>");
+
+        Curve* c = newCurve(tok[1]);
+        double takeoff = parseNumber(tok[2], -64, -0.001, "takeoff velocity");
+        double gravity = parseNumber(tok[3], 0.001, 64, "gravity");
+        bakeRise(c, takeoff, gravity);
+    } else if (!strcmp(tok[0], "ease")) {
+        if (n != 5 || (strcmp(tok[4], "linear") && strcmp(tok[4], "out") && strcmp(tok[4], "inout"))) {
+            fail("usage: ease <name> <distance> <frames> linear|out|inout");
+        }
+
+        Curve* c = newCurve(tok[1]);
+        double distance = parseNumber(tok[2], 0, 4096, "distance");
+        int frames = (int) parseNumber(tok[3], 1, MAX_LENGTH, "frames");
+        if (frames != atof(tok[3])) fail("frames must be whole");
+        bakeEase(c, distance, frames, tok[4]);
+    } else {
+        fail("unknown directive '%s'", tok[0]);
+    }
+}
+
+static void parse(FILE* in) {
+    char line[256];
+
+    while (fgets(line, sizeof(line), in)) {
+        char* tok[8];
+        int n = 0;
+
+        lineNo++;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = 0;
+
+        for (char* t = strtok(line, " \t\r\n"); t; t = strtok(NULL, " \t\r\n")) {
+            if (n == 8) fail("too many fields");
+            tok[n++] = t;
+        }
+        if (n) parseLine(tok, n);
+    }
+}
+
+static void writeSource(FILE* out, const char* header) {
+    fprintf(out, "// Generated by tools/bakecurves from %s - do not edit\n\n", specPath);
+    fprintf(out, "#include <genesis.h>\n#include \"%s\"\n", header);
+
+    for (int i = 0; i < curveCount; i++) {
+        const Curve* c = &curves[i];
+
+        // Quantized values print exactly (at most 10 fraction bits)
+        fprintf(out, "\n// %s\n", c->what);
+        fprintf(out, "static const fix32 %sVelocity[] = {", c->name);
+        for (int f = 0; f < c->length; f++) {
+            fprintf(out, "%s%sFIX32(%.10g)", f ? "," : "", (f % 8) ? " " : "\n    ",
+                    (double) c->velocity[f] / FIX32_ONE);
+        }
+        fprintf(out, "\n};\n");
+        fprintf(out, "const MotionCurve %s = { %sVelocity, %d };\n", c->name, c->name, c->length);
+    }
+}
+
+static void writeHeader(FILE* out, const char* guard) {
+    fprintf(out, "// Generated by tools/bakecurves from %s - do not edit\n\n", specPath);
+    fprintf(out, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(out, "#include <genesis.h>\n#include \"systems/motion.h\"\n\n");
+
+    for (int i = 0; i < curveCount; i++) {
+        fprintf(out, "extern const MotionCurve %s;\n", curves[i].name);
+    }
+    fprintf(out, "\n#endif // %s\n", guard);
+}
+
+/**
+ * "inc/entities/motionData.h" -> include path "entities/motionData.h", guard MOTION_DATA_H
+ */
+static void headerNames(const char* path, char* include, char* guard) {
+    const char* inc = strstr(path, "inc/");
+    const char* base = strrchr(path, '/');
+
+    strcpy(include, inc ? inc + 4 : (base ? base + 1 : path));
+
+    base = base ? base + 1 : path;
+    char* g = guard;
+    for (const char* c = base; *c && *c != '.'; c++) {
+        if (isupper((unsigned char) *c) && c != base) *g++ = '_';
+        *g++ = toupper((unsigned char) *c);
+    }
+    strcpy(g, "_H");
+}
+
+int main(int argc, char** argv) {
+    char include[256];
+    char guard[256];
+
+    if (argc != 4) {
+        fprintf(stderr, "usage: %s <spec.curves> <out.c> <out.h>\n", argv[0]);
+        return 2;
+    }
+    if (strlen(argv[3]) >= sizeof(include)) return 2;
+
+    specPath = argv[1];
+    FILE* in = fopen(specPath, "r");
+    if (!in) {
+        perror(specPath);
+        return 1;
+    }
+    parse(in);
+    fclose(in);
+
+    // Report paths relative to the project, whatever directory make ran in
+    const char* res = strstr(specPath, "res/");
+    if (res) specPath = res;
+
+    headerNames(argv[3], include, guard);
+
+    FILE* src = fopen(argv[2], "w");
+    FILE* hdr = fopen(argv[3], "w");
+    if (!src || !hdr) {
+        perror("output");
+        return 1;
+    }
+    writeSource(src, include);
+    writeHeader(hdr, guard);
+
+    return (fclose(src) || fclose(hdr)) ? 1 : 0;
+}